@@ -0,0 +1,45 @@
+/*!
+    \file block.cpp
+    \brief Block-compressed file logger example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/config.h"
+#include "logging/logger.h"
+
+void ConfigureLogger()
+{
+    // Create default logging sink processor with a binary layout
+    auto sink = std::make_shared<CppLogging::Processor>(std::make_shared<CppLogging::BinaryLayoutV2>());
+    // Add block-compressed file appender
+    sink->appenders().push_back(std::make_shared<CppLogging::BlockFileAppender>("block.bin.log.blk"));
+
+    // Configure example logger
+    CppLogging::Config::ConfigLogger("example", sink);
+
+    // Startup the logging infrastructure
+    CppLogging::Config::Startup();
+}
+
+int main(int argc, char** argv)
+{
+    // Configure logger
+    ConfigureLogger();
+
+    // Create example logger
+    CppLogging::Logger logger("example");
+
+    // Log some messages with different level
+    logger.Debug("Debug message {}", 1);
+    logger.Info("Info message {}", 2);
+    logger.Warn("Warning message {}", 3);
+    logger.Error("Error message {}", 4);
+    logger.Fatal("Fatal message {}", 5);
+
+    // Shutdown the logging infrastructure to write the block index
+    CppLogging::Config::Shutdown();
+
+    return 0;
+}
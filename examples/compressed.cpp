@@ -0,0 +1,42 @@
+/*!
+    \file compressed.cpp
+    \brief Compressed file logger example
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/config.h"
+#include "logging/logger.h"
+
+void ConfigureLogger()
+{
+    // Create default logging sink processor with a binary layout
+    auto sink = std::make_shared<CppLogging::Processor>(std::make_shared<CppLogging::BinaryLayout>());
+    // Add compressed file appender which synchronizes the gzip stream every 64kb of logs
+    sink->appenders().push_back(std::make_shared<CppLogging::CompressedFileAppender>("file.bin.log.gz"));
+
+    // Configure example logger
+    CppLogging::Config::ConfigLogger("example", sink);
+
+    // Startup the logging infrastructure
+    CppLogging::Config::Startup();
+}
+
+int main(int argc, char** argv)
+{
+    // Configure logger
+    ConfigureLogger();
+
+    // Create example logger
+    CppLogging::Logger logger("example");
+
+    // Log some messages with different level
+    logger.Debug("Debug message {}", 1);
+    logger.Info("Info message {}", 2);
+    logger.Warn("Warning message {}", 3);
+    logger.Error("Error message {}", 4);
+    logger.Fatal("Fatal message {}", 5);
+
+    return 0;
+}
@@ -14,9 +14,13 @@
 #include "logging/appenders/debug_appender.h"
 #include "logging/appenders/error_appender.h"
 #include "logging/appenders/file_appender.h"
+#include "logging/appenders/compressed_file_appender.h"
+#include "logging/appenders/block_file_appender.h"
 #include "logging/appenders/memory_appender.h"
 #include "logging/appenders/ostream_appender.h"
 #include "logging/appenders/rolling_file_appender.h"
+#include "logging/appenders/routing_file_appender.h"
+#include "logging/appenders/striped_file_appender.h"
 #include "logging/appenders/syslog_appender.h"
 
 #endif // CPPLOGGING_APPENDERS_H
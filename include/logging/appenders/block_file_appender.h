@@ -0,0 +1,221 @@
+/*!
+    \file block_file_appender.h
+    \brief Block-compressed file appender definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_APPENDERS_BLOCK_FILE_APPENDER_H
+#define CPPLOGGING_APPENDERS_BLOCK_FILE_APPENDER_H
+
+#include "logging/appender.h"
+
+#include "filesystem/filesystem.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CppLogging {
+
+//! Block encoding
+enum class BlockEncoding : uint8_t
+{
+    ROWS,       //!< Block contains raw logging records produced by the layout
+    COLUMNS     //!< Block contains logging records fields encoded as columns
+};
+
+//! Block-compressed file appender
+/*!
+    Block-compressed file appender collects logging records into blocks
+    of the given size and compresses each block with zlib deflate on the
+    logging thread. Logging records are never split between blocks, so
+    each block can be inflated and read independently.
+
+    Flush() writes only complete blocks. The partial block is written when
+    the appender is stopped or when its oldest logging record is older than
+    the maximal block age, so frequent flushes do not produce many small
+    blocks which are compressed worse and grow the block index.
+
+    Rows encoding stores raw logging records produced by the layout one
+    after another. Columns encoding ignores the layout (so NullLayout should
+    be used) and stores logging records fields of the block as separate
+    columns, which are compressed much better than rows:
+    - column directory: 32-bit records count and 32-bit sizes of six columns;
+    - timestamps: first 64-bit timestamp, zigzag varint delta and zigzag varint delta-of-delta values;
+    - threads: dictionary of varint thread Ids and varint dictionary indexes;
+    - levels: varint runs count and runs of level byte and varint run length;
+    - loggers: dictionary of varint sized logger names and varint dictionary indexes;
+    - messages: dictionary of 32-bit FNV-1a hashes with varint sized messages and varint dictionary indexes;
+    - arguments: varint sizes of logging buffers followed by their content.
+    Column directory allows tools to filter on a column without decoding
+    arguments payloads.
+
+    Block file is a seekable container:
+    - file header: magic "CLBK", version byte, encoding byte, two reserved bytes and 32-bit block size;
+    - block: block header (magic "CLBB", compressed size, raw size, records count,
+      minimal and maximal timestamps, CRC32C of compressed data and CRC32C of the block
+      header) followed by compressed data;
+    - index: magic "CLBI", 32-bit count, array of minimal timestamp, maximal timestamp
+      and file offset of each block, and CRC32C of the index. Index is written when the
+      appender is stopped, followed by the trailer: magic "CLBT" and 64-bit index offset.
+
+    Tools read the trailer and the block index to seek by time without inflating
+    the whole file. If the file was not closed properly, the block index is
+    restored by scanning block headers and skipping compressed data. When the
+    appender is started on the existing block file it restores the block index,
+    truncates the torn tail and continues to append blocks. Existing file which
+    is not a block file will be truncated.
+
+    Not thread-safe.
+
+    \see FileAppender
+*/
+class BlockFileAppender : public Appender
+{
+public:
+    //! Block file magic
+    static constexpr uint8_t FILE_MAGIC[4] = { 'C', 'L', 'B', 'K' };
+    //! Block magic
+    static constexpr uint8_t BLOCK_MAGIC[4] = { 'C', 'L', 'B', 'B' };
+    //! Block index magic
+    static constexpr uint8_t INDEX_MAGIC[4] = { 'C', 'L', 'B', 'I' };
+    //! Block file trailer magic
+    static constexpr uint8_t TRAILER_MAGIC[4] = { 'C', 'L', 'B', 'T' };
+    //! Block file version
+    static constexpr uint8_t VERSION = 1;
+    //! Block file header size
+    static constexpr size_t FILE_HEADER_SIZE = 12;
+    //! Block header size
+    static constexpr size_t BLOCK_HEADER_SIZE = 40;
+    //! Block index entry size
+    static constexpr size_t INDEX_ENTRY_SIZE = 24;
+    //! Block file trailer size
+    static constexpr size_t TRAILER_SIZE = 12;
+
+    //! Block index entry
+    struct BlockIndex
+    {
+        uint64_t first;     //!< Minimal timestamp of logging records in the block
+        uint64_t last;      //!< Maximal timestamp of logging records in the block
+        uint64_t offset;    //!< Block offset in the file
+    };
+
+    //! Initialize the appender with a given file, truncate flag, block size, compression level, block encoding and maximal block age
+    /*!
+         \param file - Logging file
+         \param truncate - Truncate flag (default is false)
+         \param block_size - Block size (default is 65536)
+         \param level - Compression level from 1 to 9 (default is 6)
+         \param encoding - Block encoding (default is BlockEncoding::ROWS)
+         \param auto_start - Auto-start flag (default is true)
+         \param max_age - Maximal age of the partial block before it is written (default is 1 second)
+    */
+    explicit BlockFileAppender(const CppCommon::Path& file, bool truncate = false, size_t block_size = 65536, int level = 6, BlockEncoding encoding = BlockEncoding::ROWS, bool auto_start = true, const CppCommon::Timespan& max_age = CppCommon::Timespan::seconds(1));
+    BlockFileAppender(const BlockFileAppender&) = delete;
+    BlockFileAppender(BlockFileAppender&&) = delete;
+    virtual ~BlockFileAppender();
+
+    BlockFileAppender& operator=(const BlockFileAppender&) = delete;
+    BlockFileAppender& operator=(BlockFileAppender&&) = delete;
+
+    //! Get the block size
+    size_t block_size() const noexcept { return _block_size; }
+    //! Get the compression level
+    int level() const noexcept { return _level; }
+    //! Get the block encoding
+    BlockEncoding encoding() const noexcept { return _encoding; }
+    //! Get the maximal block age
+    const CppCommon::Timespan& max_age() const noexcept { return _max_age; }
+    //! Get the block index of the current file
+    const std::vector<BlockIndex>& index() const noexcept { return _index; }
+
+    //! Parse the block header
+    /*!
+         \param buffer - Block header buffer (at least BLOCK_HEADER_SIZE bytes)
+         \param compressed - Compressed data size
+         \param raw - Raw data size
+         \param records - Logging records count
+         \param first - Minimal timestamp of logging records
+         \param last - Maximal timestamp of logging records
+         \param crc - CRC32C of compressed data
+         \return 'true' if the block header is valid, 'false' if the block header is corrupted
+    */
+    static bool ParseBlockHeader(const uint8_t* buffer, uint32_t& compressed, uint32_t& raw, uint32_t& records, uint64_t& first, uint64_t& last, uint32_t& crc);
+    //! Read the block index of the given block file
+    /*!
+         The block index is read from the file trailer. If the trailer or the block
+         index is corrupted, the block index is restored by scanning block headers.
+
+         \param file - Block file opened for reading
+         \param index - Block index
+         \param encoding - Block encoding of the file (default is nullptr)
+         \return End offset of the last valid block or index in the file, 0 if the file is not a block file
+    */
+    static uint64_t ReadIndex(CppCommon::File& file, std::vector<BlockIndex>& index, BlockEncoding* encoding = nullptr);
+    //! Decode logging records of the block with columns encoding
+    /*!
+         \param data - Inflated block data
+         \param size - Inflated block size
+         \param records - Decoded logging records
+         \return 'true' if the block was successfully decoded, 'false' if the block is corrupted
+    */
+    static bool DecodeColumns(const uint8_t* data, size_t size, std::vector<Record>& records);
+
+    // Implementation of Appender
+    bool IsStarted() const noexcept override { return _started; }
+    bool Start() override;
+    bool Stop() override;
+    void AppendRecord(Record& record) override;
+    void Flush() override;
+
+private:
+    struct Deflater;
+    struct Columns;
+
+    std::atomic<bool> _started{false};
+    CppCommon::Timestamp _retry{0};
+    CppCommon::File _file;
+    bool _truncate;
+    size_t _block_size;
+    int _level;
+    BlockEncoding _encoding;
+    CppCommon::Timespan _max_age;
+    std::unique_ptr<Deflater> _deflater;
+    std::unique_ptr<Columns> _columns;
+    uint64_t _offset{0};
+    uint64_t _generation{0};
+    std::vector<BlockIndex> _index;
+    std::vector<uint8_t> _block;
+    std::vector<uint8_t> _compressed;
+    uint32_t _records{0};
+    uint64_t _first{0};
+    uint64_t _last{0};
+
+    //! Prepare the file for writing
+    /*
+        - If the file is opened and ready to write immediately returns true
+        - If the last retry was earlier than 100ms immediately returns false
+        - If the file is closed try to open it, restore the block index and prepare for writing, returns true/false
+
+        \return 'true' if the file was successfully prepared, 'false' if the file failed to be prepared
+    */
+    bool PrepareFile();
+    //! Close the file with writing the block index and the trailer
+    /*
+        \return 'true' if the file was successfully closed, 'false' if the file failed to close
+    */
+    bool CloseFile();
+    //! Is the current block older than the maximal block age at the given timestamp?
+    bool IsExpired(uint64_t timestamp) const noexcept
+    { return (_records > 0) && (timestamp > _first) && ((timestamp - _first) >= (uint64_t)_max_age.total()); }
+    //! Compress and write the current block into the file
+    void WriteBlock();
+};
+
+} // namespace CppLogging
+
+/*! \example block.cpp Block-compressed file logger example */
+
+#endif // CPPLOGGING_APPENDERS_BLOCK_FILE_APPENDER_H
@@ -0,0 +1,90 @@
+/*!
+    \file compressed_file_appender.h
+    \brief Compressed file appender definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_APPENDERS_COMPRESSED_FILE_APPENDER_H
+#define CPPLOGGING_APPENDERS_COMPRESSED_FILE_APPENDER_H
+
+#include "logging/appender.h"
+#include "logging/gzip_writer.h"
+
+#include "filesystem/filesystem.h"
+
+#include <atomic>
+
+namespace CppLogging {
+
+//! Compressed file appender
+/*!
+    Compressed file appender deflates the given logging record into the gzip
+    stream of the file with the given file name (see GzipWriter), so logging
+    records are never written uncompressed and no archivation is required.
+    The deflate stream is synchronized after the given sync flush interval
+    and on flush, so the file stays readable up to the last sync flush in
+    case of a crash. Each start appends a new gzip member into the file.
+    In case of any IO error this appender will lost the logging record, but
+    try to recover from fail in a short interval of 100ms.
+
+    Not thread-safe.
+*/
+class CompressedFileAppender : public Appender
+{
+public:
+    //! Initialize the appender with a given file, truncate/append, auto-flush flags, compression level and sync flush interval
+    /*!
+         \param file - Logging file
+         \param truncate - Truncate flag (default is false)
+         \param auto_flush - Auto-flush flag to sync the deflate stream after each logging record (default is false)
+         \param auto_start - Auto-start flag (default is true)
+         \param level - Compression level from 0 to 9 or -1 for zlib default (default is 6)
+         \param sync - Sync flush interval in bytes of logging records, 0 to sync only on flush (default is 65536)
+    */
+    explicit CompressedFileAppender(const CppCommon::Path& file, bool truncate = false, bool auto_flush = false, bool auto_start = true, int level = 6, size_t sync = 65536);
+    CompressedFileAppender(const CompressedFileAppender&) = delete;
+    CompressedFileAppender(CompressedFileAppender&&) = delete;
+    virtual ~CompressedFileAppender();
+
+    CompressedFileAppender& operator=(const CompressedFileAppender&) = delete;
+    CompressedFileAppender& operator=(CompressedFileAppender&&) = delete;
+
+    // Implementation of Appender
+    bool IsStarted() const noexcept override { return _started; }
+    bool Start() override;
+    bool Stop() override;
+    void AppendRecord(Record& record) override;
+    void Flush() override;
+
+private:
+    std::atomic<bool> _started{false};
+    CppCommon::Timestamp _retry{0};
+    CppCommon::File _file;
+    bool _truncate;
+    bool _auto_flush;
+    uint64_t _generation{0};
+    GzipWriter _gzip;
+
+    //! Prepare the file for writing
+    /*
+        - If the file is opened and ready to write immediately returns true
+        - If the last retry was earlier than 100ms immediately returns false
+        - If the file is closed try to open it for writing and start a new gzip member, returns true/false
+
+        \return 'true' if the file was successfully prepared, 'false' if the file failed to be prepared
+    */
+    bool PrepareFile();
+    //! Finish the gzip member and close the file
+    /*
+        \return 'true' if the file was successfully closed, 'false' if the file failed to close
+    */
+    bool CloseFile();
+};
+
+} // namespace CppLogging
+
+/*! \example compressed.cpp Compressed file logger example */
+
+#endif // CPPLOGGING_APPENDERS_COMPRESSED_FILE_APPENDER_H
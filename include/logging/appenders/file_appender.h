@@ -10,13 +10,28 @@
 #define CPPLOGGING_APPENDERS_FILE_APPENDER_H
 
 #include "logging/appender.h"
+#include "logging/record_index.h"
+#include "logging/shared_file.h"
 
 #include "filesystem/filesystem.h"
 
 #include <atomic>
+#include <vector>
 
 namespace CppLogging {
 
+//! Shared file policy
+/*!
+    Shared file policy allows several processes to append logging records
+    into the same file. Zero size limit means the shared file is never rolled.
+*/
+struct SharedPolicy
+{
+    bool enabled{false};    //!< Shared file flag
+    uint64_t size{0};       //!< Size limit of the shared file to roll it
+    size_t backups{1};      //!< Backups count of the rolled shared file
+};
+
 //! File appender
 /*!
     File appender writes the given logging record into the file with
@@ -24,19 +39,39 @@ namespace CppLogging {
     lost the logging record, but try to recover from fail in a short
     interval of 100ms.
 
+    If the index is enabled the appender writes the sidecar logging records
+    index along with the logging file (see RecordIndex).
+
+    If the shared file policy is enabled several processes could append
+    logging records into the same file (see SharedFile). Logging records
+    are collected into batches up to SHARED_BATCH_SIZE bytes and each batch
+    is written with a single write system call on the file opened in append
+    mode, so logging records of different processes are never interleaved.
+    Logging records are never split between batches. If the size limit is
+    set, the process which finds the shared file over the limit rolls it
+    under the exclusive lock: "file.log" is renamed to "file.1.log", older
+    backups are shifted up to the backups count. Other processes find the
+    shared file rolled and open the new one. Truncate flag and the index are
+    ignored for the shared file, because other processes write into it.
+
     Not thread-safe.
 */
 class FileAppender : public Appender
 {
 public:
-    //! Initialize the appender with a given file, truncate/append and auto-flush flags
+    //! Maximal size of the logging records batch written into the shared file with a single write system call
+    static const size_t SHARED_BATCH_SIZE = 4096;
+
+    //! Initialize the appender with a given file, truncate/append, auto-flush and index flags
     /*!
          \param file - Logging file
          \param truncate - Truncate flag (default is false)
          \param auto_flush - Auto-flush flag (default is false)
          \param auto_start - Auto-start flag (default is true)
+         \param index - Index flag (default is false)
+         \param shared - Shared file policy (default is SharedPolicy())
     */
-    explicit FileAppender(const CppCommon::Path& file, bool truncate = false, bool auto_flush = false, bool auto_start = true);
+    explicit FileAppender(const CppCommon::Path& file, bool truncate = false, bool auto_flush = false, bool auto_start = true, bool index = false, const SharedPolicy& shared = SharedPolicy());
     FileAppender(const FileAppender&) = delete;
     FileAppender(FileAppender&&) = delete;
     virtual ~FileAppender();
@@ -57,6 +92,12 @@ private:
     CppCommon::File _file;
     bool _truncate;
     bool _auto_flush;
+    bool _indexed;
+    uint64_t _generation{0};
+    RecordIndex _index;
+    SharedPolicy _shared;
+    SharedFile _shared_file;
+    std::vector<uint8_t> _batch;
 
     //! Prepare the file for writing
     /*
@@ -72,6 +113,11 @@ private:
         \return 'true' if the file was successfully closed, 'false' if the file failed to close
     */
     bool CloseFile();
+
+    //! Write the logging records batch into the shared file
+    void WriteBatch();
+    //! Roll the shared file over the size limit or open the shared file rolled by another process
+    void RollShared();
 };
 
 } // namespace CppLogging
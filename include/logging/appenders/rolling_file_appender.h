@@ -12,6 +12,7 @@
 #include "logging/appender.h"
 
 #include "filesystem/filesystem.h"
+#include "time/timespan.h"
 
 #include <memory>
 
@@ -37,6 +38,40 @@ enum class TimeRollingPolicy
 template <class TOutputStream>
 TOutputStream& operator<<(TOutputStream& stream, TimeRollingPolicy policy);
 
+//! Retention policy of rolled logging files
+/*!
+    Retention policy limits rolled logging files and their zip archives by
+    the total size, the age and the count. Zero limit means unlimited.
+*/
+struct RetentionPolicy
+{
+    uint64_t bytes{0};              //!< Maximal total size of rolled logging files and archives in bytes
+    CppCommon::Timespan age{0};     //!< Maximal age of rolled logging files and archives
+    size_t files{0};                //!< Maximal count of rolled logging files and archives
+
+    //! Is the retention policy enabled?
+    bool enabled() const noexcept { return (bytes > 0) || (age.total() > 0) || (files > 0); }
+};
+
+//! Rolling file appender options
+/*!
+    Optional features of the rolling file appender. Sequence naming and
+    symlink are used only by the size-based policy.
+*/
+struct RollingOptions
+{
+    bool index{false};              //!< Index flag to write the logging records index along with each logging file
+    bool manifest{false};           //!< Manifest flag to maintain the rolling manifest in the logging path
+    size_t archive_threads{1};      //!< Archivation threads count
+    int archive_level{6};           //!< Archivation compression level from 0 to 9 or -1 for zlib default
+    bool compress{false};           //!< Inline compression flag, cannot be enabled with the archivation
+    size_t compress_sync{65536};    //!< Sync flush interval of the inline compression in bytes of logging records, 0 to sync only on flush
+    bool sequence{false};           //!< Sequence naming flag to name logging files with the monotonic sequence number
+    bool symlink{false};            //!< Symlink flag to maintain the symlink to the current logging file in the sequence naming mode
+    bool preopen{false};            //!< Pre-open flag to open the next logging file in background (in the sequence naming mode for the size-based policy)
+    RetentionPolicy retention;      //!< Retention policy of rolled logging files (in the sequence naming mode for the size-based policy)
+};
+
 //! Rolling file appender
 /*!
     Rolling file appender writes the given logging record into the file
@@ -46,13 +81,67 @@ TOutputStream& operator<<(TOutputStream& stream, TimeRollingPolicy policy);
 
     Time-based rolling policy will create a new logging file to write
     into using a special pattern (contains date & time placeholders).
+    The rolling deadline is calculated once for each logging file, so
+    logging records are checked with a single timestamp comparison.
+    Rolling periods are aligned to the local time if the pattern contains
+    local placeholders, so daylight saving time transitions are handled
+    by the timezone rules.
 
     Size-based rolling policy will create a new logging file to write
     when the current file size exceeded size limit. Logging backups
     are indexed and its count could be limited as well.
 
+    Size-based rolling policy could name logging files with the monotonic
+    sequence number instead of renaming all backups on each rolling. In
+    this mode rolling only opens the next logging file and the oldest
+    logging files are removed by the archivation thread in background.
+    The stable symlink to the current logging file could be maintained
+    as well.
+
+    If the pre-open is enabled the archivation thread opens the next logging
+    file in background ahead of time (time-based policy or size-based policy
+    with the sequence naming), so rolling only swaps file handles. The rolled
+    file is flushed & closed by the archivation thread as well. If the next
+    logging file was predicted wrong (e.g. there were no logging records for
+    the whole rolling period) it is opened in the logging thread as usual and
+    the empty prepared file is removed in background.
+
     It is possible to enable archivation of the logging backups in a
-    background thread.
+    background thread. If several archivation threads are configured, large
+    logging files are split into 1 megabyte chunks which are deflated in
+    parallel and concatenated into a single zip entry. Archivation queue depth
+    and compression time are available with archive_stats().
+
+    If the inline compression is enabled logging records are deflated into
+    the gzip stream of the logging file as they are written (see GzipWriter),
+    so rolled files are already compressed and the archivation cannot be
+    enabled. Logging files get the additional ".gz" extension, archivation
+    compression level is used and the size limit is checked against logging
+    records size before compression. The deflate stream is synchronized after
+    the given sync flush interval of logging records and on flush. The logging records index is
+    not written for compressed logging files.
+
+    If the index is enabled the appender writes the sidecar logging records
+    index along with each logging file (see RecordIndex). Indexes are renamed
+    with logging backups and removed when logging files are archived.
+
+    If the manifest is enabled the appender maintains the append-only rolling
+    manifest in the logging path (see RollingManifest) which describes each
+    logging file with its archive state, first/last timestamps, logging
+    records counts and byte size. The manifest entry of the rolled file is
+    written by the archivation thread after archivation, or on rolling if the
+    archivation is disabled.
+
+    If the retention policy is enabled the archivation thread removes the
+    oldest rolled logging files and archives which exceed the total size,
+    the age or the count limit. Rolled files are found with a single scan
+    of the logging path by the logging pattern in background, then the
+    cached inventory is updated on each rolling and archivation, so the
+    logging thread never scans directories. The retention policy is applied
+    each time a new logging file is opened. The current logging file is never
+    removed. Size-based backups without the sequence naming are renamed in the
+    logging thread and limited by the backups count, so the retention policy
+    is ignored for them.
 
     Not thread-safe.
 */
@@ -84,8 +173,9 @@ public:
          \param truncate - Truncate flag (default is false)
          \param auto_flush - Auto-flush flag (default is false)
          \param auto_start - Auto-start flag (default is true)
+         \param options - Rolling file appender options (default is RollingOptions())
     */
-    explicit RollingFileAppender(const CppCommon::Path& path, TimeRollingPolicy policy = TimeRollingPolicy::DAY, const std::string& pattern = "{UtcDateTime}.log", bool archive = false, bool truncate = false, bool auto_flush = false, bool auto_start = true);
+    explicit RollingFileAppender(const CppCommon::Path& path, TimeRollingPolicy policy = TimeRollingPolicy::DAY, const std::string& pattern = "{UtcDateTime}.log", bool archive = false, bool truncate = false, bool auto_flush = false, bool auto_start = true, const RollingOptions& options = RollingOptions());
     //! Initialize the rolling file appender with a size-based policy
     /*!
          Size-based policy for 5 backups works in a following way:
@@ -97,6 +187,14 @@ public:
          example.4.log -> example.5.log
          example.5.log -> remove
 
+         Size-based policy for 5 backups with the sequence naming works in a following way:
+
+         example.000007.log -> write (example.log -> example.000007.log)
+         example.000006.log -> keep
+         ...
+         example.000002.log -> keep
+         example.000001.log -> remove in background
+
          \param path - Logging path
          \param filename - Logging filename
          \param extension - Logging extension
@@ -106,8 +204,9 @@ public:
          \param truncate - Truncate flag (default is false)
          \param auto_flush - Auto-flush flag (default is false)
          \param auto_start - Auto-start flag (default is true)
+         \param options - Rolling file appender options (default is RollingOptions())
     */
-    explicit RollingFileAppender(const CppCommon::Path& path, const std::string& filename, const std::string& extension, size_t size = 104857600, size_t backups = 10, bool archive = false, bool truncate = false, bool auto_flush = false, bool auto_start = true);
+    explicit RollingFileAppender(const CppCommon::Path& path, const std::string& filename, const std::string& extension, size_t size = 104857600, size_t backups = 10, bool archive = false, bool truncate = false, bool auto_flush = false, bool auto_start = true, const RollingOptions& options = RollingOptions());
     RollingFileAppender(const RollingFileAppender&) = delete;
     RollingFileAppender(RollingFileAppender&& appender) = delete;
     virtual ~RollingFileAppender();
@@ -115,6 +214,24 @@ public:
     RollingFileAppender& operator=(const RollingFileAppender&) = delete;
     RollingFileAppender& operator=(RollingFileAppender&& appender) = delete;
 
+    //! Archivation statistics
+    struct ArchiveStats
+    {
+        size_t queue{0};            //!< Count of logging files waiting for archivation
+        uint64_t archived{0};       //!< Count of archived logging files
+        uint64_t bytes{0};          //!< Size of archived logging files in bytes
+        uint64_t compressed{0};     //!< Size of zip archives in bytes
+        uint64_t last_time{0};      //!< Compression time of the last archived logging file in nanoseconds
+        uint64_t max_time{0};       //!< Maximal compression time of the archived logging file in nanoseconds
+        uint64_t total_time{0};     //!< Total compression time of all archived logging files in nanoseconds
+    };
+
+    //! Get the archivation statistics
+    /*!
+         Thread-safe.
+    */
+    ArchiveStats archive_stats() const;
+
     // Implementation of Appender
     bool IsStarted() const noexcept override;
     bool Start() override;
@@ -133,6 +250,14 @@ protected:
          This handler can be used to cleanup priority or affinity of the archivation thread.
     */
     virtual void onArchiveThreadCleanup() {}
+    //! Archive file handler
+    /*!
+         This handler is called in the archivation thread when the logging file is archived.
+
+         \param archive - Zip archive path
+         \param time - Compression time
+    */
+    virtual void onArchiveFile(const CppCommon::Path& archive, const CppCommon::Timespan& time) {}
 
 private:
     class Impl;
@@ -140,7 +265,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 608;
+    static const size_t StorageSize = 768;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
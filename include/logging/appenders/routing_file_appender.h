@@ -0,0 +1,165 @@
+/*!
+    \file routing_file_appender.h
+    \brief Routing file appender definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_APPENDERS_ROUTING_FILE_APPENDER_H
+#define CPPLOGGING_APPENDERS_ROUTING_FILE_APPENDER_H
+
+#include "logging/appender.h"
+
+#include "filesystem/filesystem.h"
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CppLogging {
+
+//! Routing file appender
+/*!
+    Routing file appender writes each logging record into the file which
+    path is made from the given pattern with the logger name and the date
+    of the logging record. It replaces many file appenders with logger
+    filters, e.g. one logging file per tenant: each logging record is
+    routed with a single hash lookup of its logger, and the file name is
+    made again only when the second of the logging record is changed.
+
+    Opened files are kept in the LRU cache with the given limit. The least
+    recently used file is flushed and closed when another file should be
+    opened over the limit, so thousands of loggers could be routed with a
+    bounded number of file descriptors. Each opened file buffers writes
+    with the given buffer size.
+
+    In case of any IO error the logging record is lost and the file is
+    closed, it will be opened again on the next logging record of the same
+    route after 100ms.
+
+    Not thread-safe.
+
+    \see FileAppender
+*/
+class RoutingFileAppender : public Appender
+{
+public:
+    //! Initialize the appender with a given path, routing pattern, opened files limit and file buffer size
+    /*!
+         Routing pattern contains the following placeholders:
+         - {Logger} - converted to the logger name (characters not allowed in file names are replaced with '_', empty name is converted to "default")
+         - {UtcDate} / {LocalDate} - converted to the UTC/local date (e.g. "1997-07-16")
+         - {UtcYear} / {LocalYear} - converted to the UTC/local four-digits year (e.g. "1997")
+         - {UtcMonth} / {LocalMonth} - converted to the UTC/local two-digits month (e.g. "07")
+         - {UtcDay} / {LocalDay} - converted to the UTC/local two-digits day (e.g. "16")
+         - {UtcHour} / {LocalHour} - converted to the UTC/local two-digits hour (e.g. "19")
+
+         \param path - Logging path
+         \param pattern - Routing pattern (default is "{Logger}/{UtcDate}.log")
+         \param max_files - Maximal number of opened files (default is 256)
+         \param buffer_size - Write buffer size of each opened file (default is 8192)
+         \param auto_flush - Auto-flush flag (default is false)
+         \param auto_start - Auto-start flag (default is true)
+    */
+    explicit RoutingFileAppender(const CppCommon::Path& path, const std::string& pattern = "{Logger}/{UtcDate}.log", size_t max_files = 256, size_t buffer_size = 8192, bool auto_flush = false, bool auto_start = true);
+    RoutingFileAppender(const RoutingFileAppender&) = delete;
+    RoutingFileAppender(RoutingFileAppender&&) = delete;
+    virtual ~RoutingFileAppender();
+
+    RoutingFileAppender& operator=(const RoutingFileAppender&) = delete;
+    RoutingFileAppender& operator=(RoutingFileAppender&&) = delete;
+
+    //! Get the maximal number of opened files
+    size_t max_files() const noexcept { return _max_files; }
+    //! Get the number of currently opened files
+    size_t files() const noexcept { return _files.size(); }
+
+    // Implementation of Appender
+    bool IsStarted() const noexcept override { return _started; }
+    bool Start() override;
+    bool Stop() override;
+    void AppendRecord(Record& record) override;
+    void Flush() override;
+
+private:
+    enum class PlaceholderType
+    {
+        String,
+        Logger,
+        UtcDate,
+        UtcYear,
+        UtcMonth,
+        UtcDay,
+        UtcHour,
+        LocalDate,
+        LocalYear,
+        LocalMonth,
+        LocalDay,
+        LocalHour
+    };
+
+    struct Placeholder
+    {
+        PlaceholderType type;
+        std::string value;
+
+        explicit Placeholder(PlaceholderType t) : type(t) {}
+        Placeholder(PlaceholderType t, const std::string& v) : type(t), value(v) {}
+    };
+
+    struct Handle;
+    using HandleList = std::list<std::shared_ptr<Handle>>;
+
+    // Opened file in the LRU cache
+    struct Handle
+    {
+        std::string filename;
+        CppCommon::File file;
+        HandleList::iterator lru;
+        uint64_t generation{Record::NextGeneration()};
+        bool closed{false};
+
+        Handle(const std::string& name, const CppCommon::Path& path) : filename(name), file(path) {}
+    };
+
+    // Route of the logger with the file name of the last routed second
+    struct Route
+    {
+        uint64_t seconds{0};
+        std::string filename;
+        std::shared_ptr<Handle> handle;
+        CppCommon::Timestamp retry{0};
+    };
+
+    std::atomic<bool> _started{false};
+    CppCommon::Path _path;
+    size_t _max_files;
+    size_t _buffer_size;
+    bool _auto_flush;
+    bool _dated{false};
+    std::vector<Placeholder> _placeholders;
+
+    // Opened files in the least recently used order
+    HandleList _lru;
+    std::unordered_map<std::string, std::shared_ptr<Handle>> _files;
+    // Routes of loggers
+    std::unordered_map<std::string, Route> _routes;
+
+    void AppendPattern(const std::string& pattern);
+    void AppendPlaceholder(const std::string& placeholder);
+
+    //! Make the file name of the given logger and second
+    std::string PrepareFilename(const std::string& logger, uint64_t seconds) const;
+    //! Take the opened file from the LRU cache or open it
+    std::shared_ptr<Handle> PrepareHandle(Route& route);
+    //! Flush and close the opened file and remove it from the LRU cache
+    void CloseHandle(const std::shared_ptr<Handle>& handle);
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_APPENDERS_ROUTING_FILE_APPENDER_H
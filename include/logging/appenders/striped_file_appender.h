@@ -0,0 +1,133 @@
+/*!
+    \file striped_file_appender.h
+    \brief Striped file appender definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_APPENDERS_STRIPED_FILE_APPENDER_H
+#define CPPLOGGING_APPENDERS_STRIPED_FILE_APPENDER_H
+
+#include "logging/appender.h"
+
+#include "filesystem/filesystem.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CppLogging {
+
+//! Striping mode
+enum class StripingMode : uint8_t
+{
+    ROUND_ROBIN,    //!< Batches of logging records are distributed over stripes one after another
+    LOGGER          //!< Logging records of the same logger are always written into the same stripe
+};
+
+//! Striped file appender
+/*!
+    Striped file appender spreads logging records over several stripe files
+    with the same file name placed in separate directories, which could be
+    mounted on separate devices. Logging records are collected into batches
+    of the given size on the logging thread and each stripe writes its
+    batches with its own writer thread, so the total write bandwidth is not
+    limited by a single device.
+
+    Each logging record is tagged with the global sequence number, so the
+    binlog tool merges stripe files back into the original order:
+    binlog -i stripe0/test.bin.log stripe1/test.bin.log ...
+
+    Stripe file format:
+    - file header: magic "CLST", version byte, reserved byte, 16-bit stripe index,
+      16-bit stripes count and two reserved bytes;
+    - frame: 64-bit sequence number, 32-bit record size and the logging record
+      produced by the layout.
+
+    Sequence numbers are restored from existing stripe files when the appender
+    is started, so new logging records are merged after the previous ones. Torn
+    frames at the end of stripe files are truncated. Existing files which are
+    not stripe files of the same stripe (unreadable header, foreign file or
+    stripe index/count mismatch) are renamed aside with the ".<timestamp>.bak"
+    suffix instead of being truncated, unless the truncate flag is set. Binary
+    layout should be used to merge stripe files with the binlog tool.
+
+    Not thread-safe.
+
+    \see FileAppender
+*/
+class StripedFileAppender : public Appender
+{
+public:
+    //! Stripe file magic
+    static constexpr uint8_t FILE_MAGIC[4] = { 'C', 'L', 'S', 'T' };
+    //! Stripe file version
+    static constexpr uint8_t VERSION = 1;
+    //! Stripe file header size
+    static constexpr size_t FILE_HEADER_SIZE = 12;
+    //! Stripe frame header size
+    static constexpr size_t FRAME_HEADER_SIZE = 12;
+
+    //! Initialize the appender with given stripe directories, file name, striping mode and batch size
+    /*!
+         \param directories - Stripe directories
+         \param filename - Logging file name of each stripe
+         \param mode - Striping mode (default is StripingMode::ROUND_ROBIN)
+         \param batch_size - Logging records batch size (default is 64)
+         \param truncate - Truncate flag (default is false)
+         \param auto_start - Auto-start flag (default is true)
+    */
+    explicit StripedFileAppender(const std::vector<CppCommon::Path>& directories, const CppCommon::Path& filename, StripingMode mode = StripingMode::ROUND_ROBIN, size_t batch_size = 64, bool truncate = false, bool auto_start = true);
+    StripedFileAppender(const StripedFileAppender&) = delete;
+    StripedFileAppender(StripedFileAppender&&) = delete;
+    virtual ~StripedFileAppender();
+
+    StripedFileAppender& operator=(const StripedFileAppender&) = delete;
+    StripedFileAppender& operator=(StripedFileAppender&&) = delete;
+
+    //! Get the stripes count
+    size_t stripes() const noexcept { return _stripes.size(); }
+    //! Get the striping mode
+    StripingMode mode() const noexcept { return _mode; }
+    //! Get the logging records batch size
+    size_t batch_size() const noexcept { return _batch_size; }
+    //! Get the next sequence number
+    uint64_t sequence() const noexcept { return _sequence; }
+
+    //! Parse the stripe file header
+    /*!
+         \param buffer - Stripe file header buffer (at least FILE_HEADER_SIZE bytes)
+         \param index - Stripe index
+         \param count - Stripes count
+         \return 'true' if the stripe file header is valid, 'false' if the stripe file header is corrupted
+    */
+    static bool ParseFileHeader(const uint8_t* buffer, uint16_t& index, uint16_t& count);
+
+    // Implementation of Appender
+    bool IsStarted() const noexcept override { return _started; }
+    bool Start() override;
+    bool Stop() override;
+    void AppendRecord(Record& record) override;
+    void Flush() override;
+
+private:
+    struct Stripe;
+
+    std::atomic<bool> _started{false};
+    std::vector<std::unique_ptr<Stripe>> _stripes;
+    StripingMode _mode;
+    size_t _batch_size;
+    bool _truncate;
+    size_t _current{0};
+    uint64_t _sequence{0};
+
+    //! Send the pending batch of the given stripe to its writer thread
+    void SendBatch(Stripe& stripe);
+};
+
+} // namespace CppLogging
+
+/*! \example striped.cpp Striped file logger example */
+
+#endif // CPPLOGGING_APPENDERS_STRIPED_FILE_APPENDER_H
@@ -0,0 +1,73 @@
+/*!
+    \file chunk_decoder.h
+    \brief Parallel chunk decoder definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_CHUNK_DECODER_H
+#define CPPLOGGING_CHUNK_DECODER_H
+
+#include "logging/record.h"
+#include "logging/layouts/text_layout.h"
+
+#include "system/stream.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace CppLogging {
+
+//! Parallel chunk decoder
+/*!
+    Parallel chunk decoder is used by tools to decode chunks of the
+    memory-mapped logging file in worker threads with one text layout per
+    thread. Formatted text of chunks is written into the output in the
+    original order. Only the limited window of formatted chunks is kept in
+    memory, so workers wait for the output when they are too far ahead.
+
+    Thread-safe.
+*/
+class ChunkDecoder
+{
+public:
+    //! Input chunk of the memory-mapped logging file
+    struct Chunk
+    {
+        const uint8_t* data;    //!< Chunk data
+        size_t size;            //!< Chunk size
+        uint64_t timestamp;     //!< Known timestamp of the first logging record or zero
+    };
+
+    //! Decode the given chunk and append its formatted logging records to the given text
+    typedef std::function<void (const Chunk& chunk, TextLayout& layout, Record& record, std::string& text)> Decoder;
+
+    //! Recommended input chunk size
+    static const size_t CHUNK_SIZE = 4 * 1024 * 1024;
+
+    ChunkDecoder() = delete;
+    ChunkDecoder(const ChunkDecoder&) = delete;
+    ChunkDecoder(ChunkDecoder&&) = delete;
+    ~ChunkDecoder() = delete;
+
+    ChunkDecoder& operator=(const ChunkDecoder&) = delete;
+    ChunkDecoder& operator=(ChunkDecoder&&) = delete;
+
+    //! Decode the given chunks in worker threads and write formatted text into the output in order
+    /*!
+         Rethrows the first exception of the decoder.
+
+         \param chunks - Input chunks
+         \param output - Output writer
+         \param threads - Number of worker threads
+         \param decoder - Chunk decoder
+         \return 'true' if all chunks were successfully written, 'false' if the output failed to be written
+    */
+    static bool Decode(const std::vector<Chunk>& chunks, CppCommon::Writer& output, size_t threads, const Decoder& decoder);
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_CHUNK_DECODER_H
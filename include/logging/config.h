@@ -11,7 +11,14 @@
 
 #include "logging/logger.h"
 
+#include "threads/wait_queue.h"
+
+#include <atomic>
+#include <deque>
 #include <map>
+#include <memory>
+#include <thread>
+#include <vector>
 
 namespace CppLogging {
 
@@ -19,11 +26,40 @@ namespace CppLogging {
 /*!
     Logger configuration provides static interface to configure loggers.
 
+    Working logger processors are published as an immutable registry
+    snapshot on every Startup() call with a single atomic pointer store.
+    Creating loggers performs lookup in the current snapshot without taking
+    the configuration lock. Replaced snapshots are released in the background
+    only when all producer threads announced the newer configuration epoch
+    (see Internals::Producer), so producer threads which do not log anymore
+    delay the release until they log again or exit. Logger names
+    are hierarchical and separated with dots, so the logger "db.pool.conn"
+    will inherit the logging sink processor of "db.pool" and then "db" if
+    it was not configured directly.
+
+    Startup() can be called on the working configuration to replace logger
+    processors without Shutdown(). Producers keep logging during the swap:
+    each logger checks the configuration epoch on its hot path and picks up
+    the new logging sink processor with the next logging record. Replaced
+    logger processors are flushed and released in the background retire
+    thread together with their registry snapshot. They are never stopped,
+    because their layouts, filters and appenders might be shared with the
+    working logger processors. Shared ones are detached before the last
+    reference to the replaced processor is released, so its destructor does
+    not stop them. Loggers cache raw pointers to their logging sink
+    processors, so the configuration owns all of them.
+
     Thread-safe.
 */
 class Config
 {
+    friend class Logger;
+    friend class Internals::Producer;
+
 public:
+    //! Grace period before replaced registry snapshots are released
+    static const CppCommon::Timespan RETIRE_DELAY;
+
     Config(const Config&) = delete;
     Config(Config&&) = delete;
     ~Config();
@@ -53,8 +89,10 @@ public:
     static Logger CreateLogger();
     //! Create named logger
     /*!
-         If the named logger was not configured before an instance of the default
-         logger will be returned.
+         If the named logger was not configured before the nearest configured
+         parent logger sink will be used (e.g. "db.pool" and then "db" for the
+         "db.pool.conn" logger). If no parent logger was configured an instance
+         of the default logger will be returned.
 
          \param name - Logger name
          \return Created instance of the named logger
@@ -62,16 +100,66 @@ public:
     static Logger CreateLogger(const std::string& name);
 
     //! Startup the logging infrastructure
+    /*!
+         If the logging infrastructure is already started the new configuration
+         will be published atomically and replaced logger processors will be
+         retired in the background.
+    */
     static void Startup();
     //! Shutdown the logging infrastructure
     static void Shutdown();
 
 private:
+    struct Registry;
+    struct Retired;
+    struct ProducerExit;
+
     CppCommon::CriticalSection _lock;
     std::map<std::string, std::shared_ptr<Processor>> _config;
-    std::map<std::string, std::shared_ptr<Processor>> _working;
+    std::atomic<const Registry*> _registry{nullptr};
+    CppCommon::CriticalSection _retire_lock;
+    std::vector<Internals::Producer*> _producers;
+    std::deque<std::unique_ptr<Retired>> _retired;
+    std::thread _retire_thread;
+    std::atomic<bool> _retire_stop{false};
+    CppCommon::WaitQueue<uint64_t> _retire_queue;
+
+    Config();
+
+    //! Resolve the logging sink processor of the given logger name in the current registry snapshot
+    /*!
+         \param name - Logger name
+         \param epoch - Configuration epoch of the resolved logging sink processor
+         \return Logging sink processor or nullptr if the logging infrastructure is not started
+    */
+    static Processor* ResolveSink(const std::string& name, uint64_t& epoch);
+
+    //! Register the producer thread
+    static void Register(Internals::Producer& producer);
+    //! Unregister the producer thread
+    static void Unregister(Internals::Producer& producer);
+
+    //! Publish the new registry snapshot (must be called under the lock)
+    /*!
+         The previous snapshot and logger processors removed from it are
+         retired in the background thread.
 
-    Config() = default;
+         \param registry - Registry snapshot to publish (might be nullptr)
+    */
+    void Publish(std::unique_ptr<Registry> registry);
+
+    //! Retire thread handler
+    void RetireThread();
+    //! Release retired registry snapshots which are not used by producer threads anymore
+    /*!
+         Replaced logger processors are flushed and released without being
+         stopped. Layouts, filters, appenders and sub processors reachable
+         from the current registry snapshot are detached from them first.
+
+         \param force - Release all retired registry snapshots without waiting for producer threads
+         \return 'true' if all retired registry snapshots were released, 'false' if some of them are still used
+    */
+    bool Release(bool force);
 
     //! Get singleton instance
     static Config& GetInstance()
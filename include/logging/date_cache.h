@@ -0,0 +1,77 @@
+/*!
+    \file date_cache.h
+    \brief Date & time strings cache definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_DATE_CACHE_H
+#define CPPLOGGING_DATE_CACHE_H
+
+#include <cstdint>
+
+namespace CppLogging {
+
+//! Date & time strings cache
+/*!
+    Date & time strings cache is the process-wide cache of UTC and local
+    date & time digits rendered for the last requested second. The rendered
+    entry is published to all threads with a seqlock, so layouts and
+    appenders read it without locks and render date & time strings only
+    once per second for the whole process.
+
+    Local timezone offset is resolved with the system timezone rules once
+    per hour and is published with the range of seconds where it stays the
+    same, so daylight saving time transitions are never crossed inside the
+    range. Other seconds of the range are rendered with the integer calendar
+    arithmetic without calling system timezone functions. Changes of the
+    system timezone are picked up on the next hour.
+
+    Thread-safe.
+
+    \see TextLayout
+    \see RollingFileAppender
+*/
+class DateCache
+{
+public:
+    //! Rendered date & time digits
+    struct DateTime
+    {
+        char year[4];       //!< Four-digits year
+        char month[2];      //!< Two-digits month
+        char day[2];        //!< Two-digits day
+        char hour[2];       //!< Two-digits hour
+        char minute[2];     //!< Two-digits minute
+        char second[2];     //!< Two-digits second
+    };
+
+    //! Rendered date & time entry of the second
+    struct Entry
+    {
+        uint64_t seconds;   //!< Unix timestamp in seconds
+        int64_t offset;     //!< Local timezone offset in minutes including daylight saving time
+        DateTime utc;       //!< UTC date & time digits
+        DateTime local;     //!< Local date & time digits
+    };
+
+    DateCache() = delete;
+    DateCache(const DateCache&) = delete;
+    DateCache(DateCache&&) = delete;
+    ~DateCache() = delete;
+
+    DateCache& operator=(const DateCache&) = delete;
+    DateCache& operator=(DateCache&&) = delete;
+
+    //! Get the rendered date & time entry of the given second
+    /*!
+         \param seconds - Unix timestamp in seconds
+         \param entry - Rendered date & time entry
+    */
+    static void Get(uint64_t seconds, Entry& entry);
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_DATE_CACHE_H
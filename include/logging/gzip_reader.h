@@ -0,0 +1,95 @@
+/*!
+    \file gzip_reader.h
+    \brief Gzip file reader definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_GZIP_READER_H
+#define CPPLOGGING_GZIP_READER_H
+
+#include "filesystem/file.h"
+#include "system/stream.h"
+
+#include <memory>
+#include <vector>
+
+namespace CppLogging {
+
+//! Gzip file reader
+/*!
+    Gzip file reader inflates all gzip members of the given gzip file
+    written by GzipWriter. Only the data up to the last sync flush point
+    or the end of the gzip member is returned, so the torn or corrupted
+    logging records written after the last sync never get into the output.
+    Corrupted gzip members are skipped by resynchronization with the next
+    gzip member header.
+
+    Not thread-safe.
+
+    \see GzipWriter
+    \see ZipReader
+*/
+class GzipReader : public CppCommon::Reader
+{
+public:
+    //! Size of the compressed input buffer
+    static const size_t BUFFER_SIZE = 65536;
+    //! Maximal size of the inflated data kept until the next sync flush point
+    static const size_t PENDING_SIZE = 16777216;
+
+    //! Open the given gzip file
+    /*!
+         \param path - Gzip file path
+    */
+    explicit GzipReader(const CppCommon::Path& path);
+    GzipReader(const GzipReader&) = delete;
+    GzipReader(GzipReader&&) = delete;
+    ~GzipReader();
+
+    GzipReader& operator=(const GzipReader&) = delete;
+    GzipReader& operator=(GzipReader&&) = delete;
+
+    //! Get the count of skipped corrupted compressed bytes
+    uint64_t skipped() const noexcept { return _skipped; }
+
+    //! Read inflated data of the gzip file
+    /*!
+         \param buffer - Buffer to read
+         \param size - Buffer size
+         \return Count of read bytes, less than the buffer size only at the end of the gzip file
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+private:
+    struct Inflater;
+
+    CppCommon::Path _path;
+    CppCommon::File _file;
+    std::unique_ptr<Inflater> _inflater;
+    std::vector<uint8_t> _input;
+    std::vector<uint8_t> _output;
+    size_t _offset{0};
+    size_t _ready{0};
+    uint64_t _position{0};
+    uint64_t _valid{0};
+    uint64_t _skipped{0};
+    uint32_t _tail{0};
+
+    //! Get the offset of the next compressed byte in the gzip file
+    uint64_t offset() const noexcept;
+
+    //! Inflate the next complete deflate blocks
+    bool Inflate();
+    //! Make all inflated data ready to read
+    void Commit();
+    //! Read more compressed data
+    bool Fill();
+    //! Resynchronize with the next gzip member after the last sync flush point
+    bool Resync();
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_GZIP_READER_H
@@ -0,0 +1,91 @@
+/*!
+    \file gzip_writer.h
+    \brief Gzip stream writer definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_GZIP_WRITER_H
+#define CPPLOGGING_GZIP_WRITER_H
+
+#include "filesystem/file.h"
+
+#include <memory>
+#include <vector>
+
+namespace CppLogging {
+
+//! Gzip stream writer
+/*!
+    Gzip stream writer deflates written data into the gzip member of the
+    given file opened for writing. Each opened file gets a new gzip member,
+    so appending to the existing gzip file produces a valid multi-member
+    gzip file.
+
+    Deflate stream is synchronized with the sync flush after the given count
+    of written bytes, so all data written before the last sync flush could
+    be inflated even if the gzip member was not finished because of a crash.
+
+    Not thread-safe.
+*/
+class GzipWriter
+{
+public:
+    //! Initialize the gzip stream writer with a given compression level and sync flush interval
+    /*!
+         \param level - Compression level from 0 to 9 or -1 for zlib default (default is 6)
+         \param sync - Sync flush interval in bytes of written data, 0 to sync only on flush (default is 65536)
+    */
+    explicit GzipWriter(int level = 6, size_t sync = 65536);
+    GzipWriter(const GzipWriter&) = delete;
+    GzipWriter(GzipWriter&&) = delete;
+    ~GzipWriter();
+
+    GzipWriter& operator=(const GzipWriter&) = delete;
+    GzipWriter& operator=(GzipWriter&&) = delete;
+
+    //! Get the compression level
+    int level() const noexcept { return _level; }
+    //! Get the sync flush interval
+    size_t sync() const noexcept { return _sync; }
+
+    //! Is the gzip member opened?
+    bool IsOpened() const noexcept { return (_file != nullptr); }
+
+    //! Open a new gzip member in the given file opened for writing
+    /*!
+         \param file - File opened for writing
+    */
+    void Open(CppCommon::File& file);
+    //! Finish the gzip member
+    /*!
+         The file is not closed.
+    */
+    void Close();
+
+    //! Deflate the given data into the gzip member
+    /*!
+         \param buffer - Buffer to write
+         \param size - Buffer size
+    */
+    void Write(const void* buffer, size_t size);
+    //! Synchronize the deflate stream and flush the file
+    void Flush();
+
+private:
+    struct Deflater;
+
+    int _level;
+    size_t _sync;
+    CppCommon::File* _file{nullptr};
+    std::unique_ptr<Deflater> _deflater;
+    std::vector<uint8_t> _buffer;
+    size_t _pending{0};
+
+    void Deflate(int flush);
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_GZIP_WRITER_H
@@ -0,0 +1,144 @@
+/*!
+    \file hashlog.h
+    \brief Hash logs map definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_HASHLOG_H
+#define CPPLOGGING_HASHLOG_H
+
+#include "logging/mapped_file.h"
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CppLogging {
+
+//! Hash logs map
+/*!
+    Hash logs map contains hash code & string pairs of logger names and
+    logging messages which are used to read logs written with hash layouts.
+    32-bit hashes of the hash layout and 64-bit hashes of the 64-bit hash
+    layout are stored in the same map.
+
+    Hash logs map version 1 (.hashlog) is a sequence of entries:
+    - 32-bit entries count;
+    - entries of 32-bit hash, 16-bit string size and string content.
+
+    Hash logs map version 2 (.hashlog) is a sorted table with a journal:
+    - header: magic "CLH2", 32-bit entries count and 64-bit journal offset;
+    - index: entries of 64-bit hash, 32-bit string offset and 32-bit string
+      size sorted by hash;
+    - blob: content of all strings;
+    - journal: entries of 64-bit hash, 32-bit string size and string content
+      appended after the sorted table.
+
+    Hash logs map version 2 is memory-mapped when read, so it is ready to use
+    without parsing: strings are found with a binary search over the sorted
+    index and returned as string views into the mapped file. Only journal
+    entries are parsed on reading. New entries are appended into the journal
+    with Append() and the whole map is compacted into the sorted table with
+    Write(). Hash logs map version 1 is read into memory.
+
+    Not thread-safe.
+
+    \see HashLayout
+    \see Hash64Layout
+*/
+class Hashlog
+{
+public:
+    //! Hash logs map version 2 magic
+    static constexpr uint8_t MAGIC[4] = { 'C', 'L', 'H', '2' };
+    //! Hash logs map version 2 header size
+    static constexpr size_t HEADER_SIZE = 16;
+    //! Hash logs map version 2 index entry size
+    static constexpr size_t ENTRY_SIZE = 16;
+    //! Hash logs map version 2 journal entry header size
+    static constexpr size_t JOURNAL_ENTRY_SIZE = 12;
+
+    Hashlog() = default;
+    Hashlog(const Hashlog&) = delete;
+    Hashlog(Hashlog&&) = delete;
+    ~Hashlog();
+
+    Hashlog& operator=(const Hashlog&) = delete;
+    Hashlog& operator=(Hashlog&&) = delete;
+
+    //! Check if the hash logs map is empty
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get the hash logs map size
+    size_t size() const noexcept { return _count + _journal.size() + _strings.size(); }
+
+    //! Find the string with the given hash
+    /*!
+         \param hash - Hash value
+         \param value - Found string value
+         \return 'true' if the string was found, 'false' if the string was not found
+    */
+    bool Find(uint64_t hash, std::string_view& value) const;
+
+    //! Insert the string with the given hash
+    /*!
+         \param hash - Hash value
+         \param value - String value
+         \return 'true' if the string was inserted or already exists, 'false' if another string with the same hash exists (collision)
+    */
+    bool Insert(uint64_t hash, std::string_view value);
+
+    //! Clear the hash logs map
+    void Clear();
+
+    //! Read the hash logs map from the given .hashlog file
+    /*!
+         \param path - .hashlog file path
+         \return 'true' if the hash logs map was successfully read, 'false' if the file is missing or corrupted
+    */
+    bool Read(const CppCommon::Path& path);
+    //! Write the whole hash logs map into the given .hashlog file
+    /*!
+         All entries are compacted into the sorted table. The file is not
+         rewritten if its content is the same.
+
+         \param path - .hashlog file path
+    */
+    void Write(const CppCommon::Path& path);
+    //! Append inserted entries into the journal of the given .hashlog file
+    /*!
+         If the given file is not the hash logs map version 2 which was read
+         before, the whole hash logs map is written.
+
+         \param path - .hashlog file path
+    */
+    void Append(const CppCommon::Path& path);
+
+private:
+    // Memory-mapped file
+    MappedFile _file;
+
+    // Sorted table
+    const uint8_t* _index{nullptr};
+    const uint8_t* _blob{nullptr};
+    size_t _blob_size{0};
+    size_t _count{0};
+
+    // Journal entries and the valid end of the journal
+    std::unordered_map<uint64_t, std::string_view> _journal;
+    size_t _end{0};
+
+    // Read or inserted entries which are not in the memory-mapped file
+    std::map<uint64_t, std::string> _strings;
+    std::vector<uint64_t> _pending;
+
+    void Unmap();
+    bool FindIndex(uint64_t hash, std::string_view& value) const;
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_HASHLOG_H
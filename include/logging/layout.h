@@ -22,6 +22,9 @@ namespace CppLogging {
     \see NullLayout
     \see EmptyLayout
     \see BinaryLayout
+    \see HashLayout
+    \see Hash64Layout
+    \see DictionaryLayout
     \see TextLayout
 */
 class Layout : public Element
@@ -12,7 +12,10 @@
 #include "logging/layouts/null_layout.h"
 #include "logging/layouts/empty_layout.h"
 #include "logging/layouts/binary_layout.h"
+#include "logging/layouts/binary_layout_v2.h"
 #include "logging/layouts/hash_layout.h"
+#include "logging/layouts/hash64_layout.h"
+#include "logging/layouts/dictionary_layout.h"
 #include "logging/layouts/text_layout.h"
 
 #endif // CPPLOGGING_LAYOUTS_H
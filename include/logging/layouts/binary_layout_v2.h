@@ -0,0 +1,110 @@
+/*!
+    \file binary_layout_v2.h
+    \brief Binary layout version 2 definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_LAYOUTS_BINARY_LAYOUT_V2_H
+#define CPPLOGGING_LAYOUTS_BINARY_LAYOUT_V2_H
+
+#include "logging/layout.h"
+
+namespace CppLogging {
+
+//! Binary layout version 2
+/*!
+    Binary layout version 2 converts the given logging record into the
+    versioned, self-synchronizing binary frame.
+
+    Binary stream is a sequence of sync frames and logging record frames:
+    - sync frame: magic "CLB2", version byte, reserved byte, 64-bit base timestamp
+      and CRC32C of the preceding sync frame bytes;
+    - logging record frame: record tag byte, varint payload size, payload and
+      CRC32C of the payload.
+
+    Logging record payload contains zigzag varint timestamp delta from the
+    previous logging record, varint thread Id, level byte, and varint sized
+    logger name, message and buffer. Sync frame base timestamp is the
+    timestamp of the previous logging record, so the delta chain is never
+    broken and readers can restore timestamps of logging records preceding
+    the first sync frame backward from its base.
+
+    Sync frame is written before the first logging record, after each
+    'sync_interval' logging records and when the logging record timestamp
+    crosses a second boundary. So every file started by time rolling begins
+    with a sync frame, and readers are able to seek into the middle of the
+    binary stream and recover after corrupted or torn logging record frames
+    by scanning for the next valid frame.
+
+    Not thread-safe.
+
+    \see BinaryLayout
+*/
+class BinaryLayoutV2 : public Layout
+{
+public:
+    //! Binary stream magic
+    static constexpr uint8_t MAGIC[4] = { 'C', 'L', 'B', '2' };
+    //! Binary stream version
+    static constexpr uint8_t VERSION = 2;
+    //! Sync frame size
+    static constexpr size_t SYNC_SIZE = 18;
+    //! Logging record frame tag
+    static constexpr uint8_t RECORD_TAG = 0xA5;
+
+    //! Initialize binary layout version 2 with a given sync interval
+    /*!
+         \param sync_interval - Count of logging records between sync frames (default is 1024)
+    */
+    explicit BinaryLayoutV2(size_t sync_interval = 1024);
+    BinaryLayoutV2(const BinaryLayoutV2&) = delete;
+    BinaryLayoutV2(BinaryLayoutV2&&) = delete;
+    virtual ~BinaryLayoutV2() = default;
+
+    BinaryLayoutV2& operator=(const BinaryLayoutV2&) = delete;
+    BinaryLayoutV2& operator=(BinaryLayoutV2&&) = delete;
+
+    //! Get the sync interval
+    size_t sync_interval() const noexcept { return _sync_interval; }
+
+    //! Calculate CRC32C (Castagnoli) checksum of the given buffer
+    /*!
+         Hardware CRC32 instructions are used if supported by CPU.
+
+         \param data - Buffer data
+         \param size - Buffer size
+         \param crc - Initial CRC32C value (default is 0)
+         \return Calculated CRC32C value
+    */
+    static uint32_t CRC32C(const void* data, size_t size, uint32_t crc = 0);
+
+    //! Write the unsigned varint value into the given buffer
+    /*!
+         \param buffer - Buffer to write (at least 10 bytes)
+         \param value - Value to write
+         \return Count of written bytes
+    */
+    static size_t WriteVarint(uint8_t* buffer, uint64_t value);
+    //! Read the unsigned varint value from the given buffer
+    /*!
+         \param buffer - Buffer to read
+         \param size - Buffer size
+         \param value - Read value
+         \return Count of read bytes or 0 if the varint value is truncated or malformed
+    */
+    static size_t ReadVarint(const uint8_t* buffer, size_t size, uint64_t& value);
+
+    // Implementation of Layout
+    void LayoutRecord(Record& record) override;
+
+private:
+    size_t _sync_interval;
+    size_t _records{0};
+    uint64_t _timestamp{0};
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_LAYOUTS_BINARY_LAYOUT_V2_H
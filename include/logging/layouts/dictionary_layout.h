@@ -0,0 +1,75 @@
+/*!
+    \file dictionary_layout.h
+    \brief Dictionary layout definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_LAYOUTS_DICTIONARY_LAYOUT_H
+#define CPPLOGGING_LAYOUTS_DICTIONARY_LAYOUT_H
+
+#include "logging/layouts/hash_layout.h"
+
+#include <unordered_set>
+
+namespace CppLogging {
+
+//! Dictionary layout
+/*!
+    Dictionary layout converts the given logging record into the same
+    raw buffer as the hash layout does, but also emits inline dictionary
+    entries with the logger name or the logging message the first time
+    its hash appears in the logging stream. So the logging stream is
+    self-describing and could be read without external .hashlog file.
+
+    Dictionary entry is stored as 32-bit entry size with the highest
+    DICTIONARY_FLAG bit set, followed by 32-bit FNV-1a hash and the
+    string content. Logging record frames of the hash layout never set
+    this bit, so readers distinguish dictionary entries by the size.
+
+    Logger names and logging messages are tracked in separate sets of
+    hashes, so the hash collision of a logger name with a logging message
+    never suppresses a dictionary entry.
+
+    Dictionary is kept per logging file, so every logging file repeats
+    dictionary entries it needs and could be read on its own. The layout
+    marks the logging record with its logging file generation. When a file
+    appender writes the logging record into another logging file (e.g. the
+    first logging record after rolling, or the file of another logger in
+    the routing file appender), the record is laid out once again and the
+    dictionary is reset for the new logging file generation.
+
+    Not thread-safe.
+
+    \see HashLayout
+*/
+class DictionaryLayout : public Layout
+{
+public:
+    //! Dictionary entry flag of the entry size
+    static constexpr uint32_t DICTIONARY_FLAG = 0x80000000u;
+
+    DictionaryLayout() = default;
+    DictionaryLayout(const DictionaryLayout&) = delete;
+    DictionaryLayout(DictionaryLayout&&) = delete;
+    virtual ~DictionaryLayout() = default;
+
+    DictionaryLayout& operator=(const DictionaryLayout&) = delete;
+    DictionaryLayout& operator=(DictionaryLayout&&) = delete;
+
+    //! Reset the dictionary to emit all dictionary entries again
+    void Reset() { _loggers.clear(); _messages.clear(); }
+
+    // Implementation of Layout
+    void LayoutRecord(Record& record) override;
+
+private:
+    uint64_t _generation{0};
+    std::unordered_set<uint32_t> _loggers;
+    std::unordered_set<uint32_t> _messages;
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_LAYOUTS_DICTIONARY_LAYOUT_H
@@ -0,0 +1,65 @@
+/*!
+    \file hash64_layout.h
+    \brief 64-bit hash layout definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_LAYOUTS_HASH64_LAYOUT_H
+#define CPPLOGGING_LAYOUTS_HASH64_LAYOUT_H
+
+#include "logging/layout.h"
+
+namespace CppLogging {
+
+//! 64-bit hash layout
+/*!
+    64-bit hash layout performs simple memory copy operation to convert
+    the given logging record into the plane raw buffer. Logger name and
+    logging message are stored as 64-bit hashes, so the chance of hash
+    collisions on large sets of logging messages is negligible.
+
+    Logging record size of the 64-bit hash layout has HASH64_FLAG bit set,
+    so readers distinguish such logging records from hash layout ones.
+
+    Hash algorithm is 64-bit wyhash-style multiply-mix string hashing.
+
+    Thread-safe.
+
+    \see HashLayout
+*/
+class Hash64Layout : public Layout
+{
+public:
+    //! 64-bit hash logging record flag of the logging record size
+    static constexpr uint32_t HASH64_FLAG = 0x40000000u;
+
+    Hash64Layout() = default;
+    Hash64Layout(const Hash64Layout&) = delete;
+    Hash64Layout(Hash64Layout&&) = delete;
+    virtual ~Hash64Layout() = default;
+
+    Hash64Layout& operator=(const Hash64Layout&) = delete;
+    Hash64Layout& operator=(Hash64Layout&&) = delete;
+
+    //! Hash the given string message using 64-bit wyhash-style hashing algorithm
+    /*!
+         String is processed by 16 or 48 bytes blocks with 64x64->128-bit
+         multiplications folded into 64-bit values, which is much faster
+         than byte by byte FNV-1a hashing for long messages.
+
+         https://github.com/wangyi-fudan/wyhash
+
+         \param message - Message string
+         \return Calculated 64-bit hash value of the message
+    */
+    static uint64_t Hash(std::string_view message);
+
+    // Implementation of Layout
+    void LayoutRecord(Record& record) override;
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_LAYOUTS_HASH64_LAYOUT_H
@@ -11,12 +11,104 @@
 
 #include "logging/processors.h"
 
+#include "threads/spin_lock.h"
+
+#include <atomic>
+
 namespace CppLogging {
 
+class Config;
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Current configuration epoch (zero epoch is never published)
+extern std::atomic<uint64_t> ConfigEpoch;
+
+//! Logging producer thread
+/*!
+    Producer thread announces the most recent configuration epoch it has
+    seen when it enters the outermost logging call. Registry snapshots and
+    logger processors replaced by the live reconfiguration are released
+    only when all producer threads announced the newer epoch, so they might
+    be used without reference counting on the logging hot path.
+
+    Not thread-safe.
+*/
+class Producer
+{
+    friend class CppLogging::Config;
+
+public:
+    //! Producer scope of the logging call
+    class Scope
+    {
+    public:
+        Scope() : _producer(Current()), _epoch(_producer.Enter()) {}
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        ~Scope() { _producer.Leave(); }
+
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+        //! Get the configuration epoch at the scope enter
+        uint64_t epoch() const noexcept { return _epoch; }
+
+    private:
+        Producer& _producer;
+        uint64_t _epoch;
+    };
+
+    //! Get the producer of the current thread
+    static Producer& Current() noexcept
+    { static thread_local Producer producer; return producer; }
+
+private:
+    std::atomic<uint64_t> _epoch{0};
+    size_t _depth{0};
+    bool _registered{false};
+    bool _exited{false};
+
+    //! Enter the logging call
+    /*!
+         \return Current configuration epoch
+    */
+    uint64_t Enter()
+    {
+        uint64_t epoch = ConfigEpoch.load(std::memory_order_acquire);
+        if ((_depth == 0) && (_epoch.load(std::memory_order_relaxed) != epoch))
+            epoch = Announce(epoch);
+        ++_depth;
+        return epoch;
+    }
+    //! Leave the logging call
+    void Leave() noexcept { --_depth; }
+
+    //! Announce the given configuration epoch and register the producer thread on demand
+    /*!
+         \param epoch - Configuration epoch
+         \return Announced configuration epoch
+    */
+    uint64_t Announce(uint64_t epoch);
+};
+
+} // namespace Internals
+//! @endcond
+
 //! Logger interface
 /*!
     Logger is a main interface to produce logging records with a desired level.
 
+    Logger caches the raw pointer to its logging sink processor together
+    with the configuration epoch and checks the epoch against the current
+    one before each logging record. If the logging configuration was changed
+    the logging sink processor will be resolved once again, so there is no
+    need to call Update() after the live reconfiguration. Logging sink
+    processors are owned by the configuration, which keeps replaced ones
+    until all producer threads announced the newer epoch, so the logging
+    hot path does no reference counting.
+
     Thread-safe or not thread-safe depends on the current logging sink.
 */
 class Logger
@@ -31,12 +123,12 @@ public:
          \param name - Logger name
     */
     explicit Logger(const std::string& name);
-    Logger(const Logger&) = default;
-    Logger(Logger&&) = default;
+    Logger(const Logger& logger) : _name(logger._name) {}
+    Logger(Logger&& logger) noexcept : _name(std::move(logger._name)) {}
     ~Logger();
 
-    Logger& operator=(const Logger&) = default;
-    Logger& operator=(Logger&&) = default;
+    Logger& operator=(const Logger& logger);
+    Logger& operator=(Logger&& logger) noexcept;
 
     //! Log debug message
     /*!
@@ -115,14 +207,31 @@ public:
 
 private:
     std::string _name;
-    std::shared_ptr<Processor> _sink;
+    mutable CppCommon::SpinLock _lock;
+    mutable std::atomic<uint64_t> _epoch{0};
+    mutable std::atomic<Processor*> _sink{nullptr};
 
     //! Initialize logger
     /*!
          \param name - Logger name
          \param sink - Logger sink processor
+         \param epoch - Configuration epoch of the logger sink processor
+    */
+    explicit Logger(const std::string& name, Processor* sink, uint64_t epoch);
+
+    //! Get the logger sink processor for the given configuration epoch
+    /*!
+         Must be called in the producer scope.
+
+         \param epoch - Configuration epoch of the producer scope
+         \return Logger sink processor or nullptr if the logging infrastructure is not started
+    */
+    Processor* Sink(uint64_t epoch) const;
+    //! Resolve the logger sink processor in the most recent registry snapshot
+    /*!
+         \return Logger sink processor or nullptr if the logging infrastructure is not started
     */
-    explicit Logger(const std::string& name, const std::shared_ptr<Processor>& sink);
+    Processor* Resolve() const;
 
     //! Log the given message with a given level and format arguments list
     /*!
@@ -8,13 +8,41 @@
 
 namespace CppLogging {
 
-inline Logger::Logger(const std::string& name, const std::shared_ptr<Processor>& sink) : _name(name), _sink(sink)
+inline Logger::Logger(const std::string& name, Processor* sink, uint64_t epoch) : _name(name), _epoch(epoch), _sink(sink)
 {
 }
 
+inline Logger& Logger::operator=(const Logger& logger)
+{
+    _name = logger._name;
+    Update();
+    return *this;
+}
+
+inline Logger& Logger::operator=(Logger&& logger) noexcept
+{
+    _name = std::move(logger._name);
+    Update();
+    return *this;
+}
+
 inline Logger::~Logger()
 {
-    Flush();
+    // Flush the cached logger sink processor only if it is still valid for the current
+    // configuration epoch, so loggers might be safely destroyed after the shutdown
+    if (_epoch.load(std::memory_order_acquire) == Internals::ConfigEpoch.load(std::memory_order_acquire))
+        Flush();
+}
+
+inline Processor* Logger::Sink(uint64_t epoch) const
+{
+    // Fast path: the cached logger sink processor is valid for the current configuration epoch.
+    // The sink is always stored before the epoch, so the acquired epoch guarantees the matched sink.
+    if (_epoch.load(std::memory_order_acquire) == epoch)
+        return _sink.load(std::memory_order_relaxed);
+
+    // Slow path: resolve the logger sink processor in the most recent registry snapshot
+    return Resolve();
 }
 
 template <typename... T>
@@ -34,11 +62,15 @@ inline void Logger::Log(Level level, bool format, fmt::format_string<T...> messa
     record.level = level;
     record.logger = _name;
 
+    // Enter the producer scope, so the logging sink is not released during the logging call
+    Internals::Producer::Scope scope;
+
     // Check for valid and started logging sink
-    if (_sink && _sink->IsStarted())
+    Processor* sink = Sink(scope.epoch());
+    if (sink && sink->IsStarted())
     {
         // Filter the logging record
-        if (!_sink->FilterRecord(record))
+        if (!sink->FilterRecord(record))
             return;
 
         // Format or serialize arguments list
@@ -48,7 +80,7 @@ inline void Logger::Log(Level level, bool format, fmt::format_string<T...> messa
             record.StoreFormat(message, std::forward<T>(args)...);
 
         // Process the logging record
-        _sink->ProcessRecord(record);
+        sink->ProcessRecord(record);
     }
 }
 
@@ -88,8 +120,12 @@ inline void Logger::Fatal(fmt::format_string<T...> message, T&&... args) const
 
 inline void Logger::Flush()
 {
-    if (_sink && _sink->IsStarted())
-        _sink->Flush();
+    // Enter the producer scope, so the logging sink is not released during the flush
+    Internals::Producer::Scope scope;
+
+    Processor* sink = Sink(scope.epoch());
+    if (sink && sink->IsStarted())
+        sink->Flush();
 }
 
 } // namespace CppLogging
@@ -0,0 +1,72 @@
+/*!
+    \file mapped_file.h
+    \brief Memory-mapped file definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_MAPPED_FILE_H
+#define CPPLOGGING_MAPPED_FILE_H
+
+#include "filesystem/path.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppLogging {
+
+//! Memory-mapped file
+/*!
+    Memory-mapped file maps the whole file into the process memory for
+    reading. It is used by tools and hash logs map to read large files
+    without copying them through buffers. Empty file cannot be mapped.
+
+    Not thread-safe.
+*/
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    ~MappedFile() { Unmap(); }
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    //! Check if the file is mapped
+    explicit operator bool() const noexcept { return IsMapped(); }
+
+    //! Get the mapped file path
+    const CppCommon::Path& path() const noexcept { return _path; }
+    //! Get the mapped file data
+    const uint8_t* data() const noexcept { return _data; }
+    //! Get the mapped file size
+    size_t size() const noexcept { return _size; }
+
+    //! Is the file mapped?
+    bool IsMapped() const noexcept { return (_data != nullptr); }
+
+    //! Map the given file for reading
+    /*!
+         \param path - File path
+         \return 'true' if the file was successfully mapped, 'false' if the file is missing, empty or failed to be mapped
+    */
+    bool Map(const CppCommon::Path& path);
+    //! Unmap the file
+    void Unmap();
+
+private:
+    CppCommon::Path _path;
+    const uint8_t* _data{nullptr};
+    size_t _size{0};
+#if defined(_WIN32) || defined(_WIN64)
+    void* _file{nullptr};
+    void* _mapping{nullptr};
+#endif
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_MAPPED_FILE_H
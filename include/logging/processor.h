@@ -23,6 +23,8 @@ namespace CppLogging {
     Not thread-safe.
 
     \see SyncProcessor
+    \see FlatCombiningProcessor
+    \see StaticProcessor
     \see AsyncProcessor
     \see BufferedProcessor
     \see ExclusiveProcessor
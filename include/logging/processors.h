@@ -12,6 +12,8 @@
 #include "logging/processors/exclusive_processor.h"
 #include "logging/processors/buffered_processor.h"
 #include "logging/processors/sync_processor.h"
+#include "logging/processors/flat_combining_processor.h"
+#include "logging/processors/static_processor.h"
 #include "logging/processors/async_wait_processor.h"
 #include "logging/processors/async_wait_free_processor.h"
 
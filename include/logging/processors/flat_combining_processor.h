@@ -0,0 +1,95 @@
+/*!
+    \file flat_combining_processor.h
+    \brief Flat-combining logging processor definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_PROCESSORS_FLAT_COMBINING_PROCESSOR_H
+#define CPPLOGGING_PROCESSORS_FLAT_COMBINING_PROCESSOR_H
+
+#include "logging/processor.h"
+
+#include "threads/critical_section.h"
+
+#include <atomic>
+#include <exception>
+
+namespace CppLogging {
+
+//! Flat-combining logging processor
+/*!
+    Flat-combining logging processor is a synchronous logging processor
+    optimized for a high contention of producer threads. Each producer
+    publishes the given logging record into its own publication slot and
+    the thread which acquires the combiner lock processes all pending
+    logging records in one pass. Other producers spin until their logging
+    records are processed, so the synchronous semantic is preserved: the
+    method returns after the logging record was written by appenders.
+    If filters, layout or appenders throw an exception while the logging
+    record is processed, the exception is rethrown to its producer.
+
+    Thread-safe.
+
+    \see SyncProcessor
+*/
+class FlatCombiningProcessor : public Processor
+{
+public:
+    //! Initialize flat-combining logging processor with a given layout interface and publication slots count
+    /*!
+         \param layout - Logging layout interface
+         \param slots - Publication slots count (default is 64)
+    */
+    explicit FlatCombiningProcessor(const std::shared_ptr<Layout>& layout, size_t slots = 64);
+    FlatCombiningProcessor(const FlatCombiningProcessor&) = delete;
+    FlatCombiningProcessor(FlatCombiningProcessor&&) = delete;
+    virtual ~FlatCombiningProcessor() { delete[] _slots; }
+
+    FlatCombiningProcessor& operator=(const FlatCombiningProcessor&) = delete;
+    FlatCombiningProcessor& operator=(FlatCombiningProcessor&&) = delete;
+
+    //! Get publication slots count
+    size_t slots() const noexcept { return _count; }
+
+    // Implementation of Processor
+    bool ProcessRecord(Record& record) override;
+    void Flush() override;
+
+private:
+    enum SlotState : uint8_t
+    {
+        SLOT_FREE,          //!< Publication slot is free
+        SLOT_CLAIMED,       //!< Publication slot is claimed by the producer
+        SLOT_PENDING,       //!< Logging record is published and waits for the combiner
+        SLOT_COMBINING,     //!< Logging record is processing by the combiner
+        SLOT_PROCESSED,     //!< Logging record was processed
+        SLOT_STOPPED        //!< Logging record was processed and further processing was stopped
+    };
+
+    typedef char cache_line_pad[128];
+
+    struct Slot
+    {
+        std::atomic<uint8_t> state{SLOT_FREE};
+        Record* record{nullptr};
+        std::exception_ptr error;
+        cache_line_pad pad;
+    };
+
+    CppCommon::CriticalSection _lock;
+    const size_t _count;
+    Slot* const _slots;
+    cache_line_pad _pad;
+    std::atomic<size_t> _pending{0};
+
+    //! Publish the given logging record into the free publication slot
+    Slot& PublishRecord(Record& record);
+    //! Process all pending logging records under the combiner lock
+    void CombineRecords();
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_PROCESSORS_FLAT_COMBINING_PROCESSOR_H
@@ -0,0 +1,163 @@
+/*!
+    \file static_processor.h
+    \brief Static logging processor definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_PROCESSORS_STATIC_PROCESSOR_H
+#define CPPLOGGING_PROCESSORS_STATIC_PROCESSOR_H
+
+#include "logging/processor.h"
+
+#include "threads/critical_section.h"
+
+#include <tuple>
+#include <utility>
+
+namespace CppLogging {
+
+//! Static logging filters list
+/*!
+    Compile-time list of logging filter types for the static logging processor.
+*/
+template <class... TFilters>
+struct Filters {};
+
+//! Static logging appenders list
+/*!
+    Compile-time list of logging appender types for the static logging processor.
+*/
+template <class... TAppenders>
+struct Appenders {};
+
+//! @cond INTERNALS
+
+namespace Internals {
+
+//! Static chain of logging elements stored by value
+template <class... T>
+class StaticChain;
+
+template <>
+class StaticChain<>
+{
+public:
+    StaticChain() = default;
+
+    bool Start() { return true; }
+    bool Stop() { return true; }
+    bool FilterRecord(Record& record) { return true; }
+    void AppendRecord(Record& record) {}
+    void Flush() {}
+};
+
+template <class T, class... Ts>
+class StaticChain<T, Ts...>
+{
+public:
+    StaticChain() = default;
+    template <class TArgs, class... TOtherArgs>
+    explicit StaticChain(TArgs&& args, TOtherArgs&&... other)
+        : _head(std::make_from_tuple<T>(std::forward<TArgs>(args))),
+          _tail(std::forward<TOtherArgs>(other)...)
+    {}
+
+    template <size_t I>
+    auto& Get() noexcept { if constexpr (I == 0) return _head; else return _tail.template Get<I - 1>(); }
+
+    bool Start();
+    bool Stop();
+    bool FilterRecord(Record& record) { return _head.T::FilterRecord(record) && _tail.FilterRecord(record); }
+    void AppendRecord(Record& record) { _head.T::AppendRecord(record); _tail.AppendRecord(record); }
+    void Flush() { _head.T::Flush(); _tail.Flush(); }
+
+private:
+    T _head;
+    StaticChain<Ts...> _tail;
+};
+
+} // namespace Internals
+
+//! @endcond
+
+//! Static logging processor
+template <class TFilters, class TLayout, class TAppenders>
+class StaticProcessor;
+
+//! Static logging processor
+/*!
+    Static logging processor composes filters, layout and appenders at
+    compile time. All logging elements are stored by value and called
+    with qualified names, so the whole processing chain is inlined
+    without virtual dispatch, shared pointers and per element started
+    checks. Logging elements are started and stopped together with the
+    processor. Dynamic filters, layout and appenders collections of the
+    base processor are not used, only sub processors are processed.
+
+    Logging elements are constructed from the given tuples of constructor
+    arguments, one tuple per element:
+    \code{.cpp}
+    StaticProcessor<Filters<LevelFilter>, TextLayout, Appenders<FileAppender>> sink(
+        std::make_tuple(std::make_tuple(Level::INFO)),
+        std::make_tuple(),
+        std::make_tuple(std::make_tuple(CppCommon::Path("file.log"))));
+    \endcode
+
+    Static logging processor process the given logging record under the
+    critical section as the synchronous logging processor does.
+
+    Thread-safe.
+
+    \see SyncProcessor
+*/
+template <class... TFilters, class TLayout, class... TAppenders>
+class StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>> : public Processor
+{
+public:
+    //! Initialize static logging processor with default constructed logging elements
+    StaticProcessor() : Processor(nullptr) {}
+    //! Initialize static logging processor with given constructor arguments of logging elements
+    /*!
+         \param filters - Tuple of filters constructor arguments tuples
+         \param layout - Tuple of layout constructor arguments
+         \param appenders - Tuple of appenders constructor arguments tuples
+    */
+    template <class TFiltersArgs, class TLayoutArgs, class TAppendersArgs>
+    explicit StaticProcessor(TFiltersArgs&& filters, TLayoutArgs&& layout, TAppendersArgs&& appenders);
+    StaticProcessor(const StaticProcessor&) = delete;
+    StaticProcessor(StaticProcessor&&) = delete;
+    virtual ~StaticProcessor();
+
+    StaticProcessor& operator=(const StaticProcessor&) = delete;
+    StaticProcessor& operator=(StaticProcessor&&) = delete;
+
+    //! Get the static logging filter with a given index
+    template <size_t I>
+    auto& filter() noexcept { return _filters.template Get<I>(); }
+    //! Get the static logging layout
+    TLayout& static_layout() noexcept { return _layout; }
+    //! Get the static logging appender with a given index
+    template <size_t I>
+    auto& appender() noexcept { return _appenders.template Get<I>(); }
+
+    // Implementation of Processor
+    bool Start() override;
+    bool Stop() override;
+    bool FilterRecord(Record& record) override;
+    bool ProcessRecord(Record& record) override;
+    void Flush() override;
+
+private:
+    CppCommon::CriticalSection _lock;
+    Internals::StaticChain<TFilters...> _filters;
+    TLayout _layout;
+    Internals::StaticChain<TAppenders...> _appenders;
+};
+
+} // namespace CppLogging
+
+#include "static_processor.inl"
+
+#endif // CPPLOGGING_PROCESSORS_STATIC_PROCESSOR_H
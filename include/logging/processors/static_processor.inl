@@ -0,0 +1,144 @@
+/*!
+    \file static_processor.inl
+    \brief Static logging processor inline implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+namespace Internals {
+
+template <class T, class... Ts>
+inline bool StaticChain<T, Ts...>::Start()
+{
+    if (!_head.T::IsStarted())
+        if (!_head.T::Start())
+            return false;
+
+    return _tail.Start();
+}
+
+template <class T, class... Ts>
+inline bool StaticChain<T, Ts...>::Stop()
+{
+    if (_head.T::IsStarted())
+        if (!_head.T::Stop())
+            return false;
+
+    return _tail.Stop();
+}
+
+} // namespace Internals
+
+//! @endcond
+
+template <class... TFilters, class TLayout, class... TAppenders>
+template <class TFiltersArgs, class TLayoutArgs, class TAppendersArgs>
+inline StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>>::StaticProcessor(TFiltersArgs&& filters, TLayoutArgs&& layout, TAppendersArgs&& appenders)
+    : Processor(nullptr),
+      _filters(std::make_from_tuple<Internals::StaticChain<TFilters...>>(std::forward<TFiltersArgs>(filters))),
+      _layout(std::make_from_tuple<TLayout>(std::forward<TLayoutArgs>(layout))),
+      _appenders(std::make_from_tuple<Internals::StaticChain<TAppenders...>>(std::forward<TAppendersArgs>(appenders)))
+{
+}
+
+template <class... TFilters, class TLayout, class... TAppenders>
+inline StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>>::~StaticProcessor()
+{
+    // Flush and stop static logging elements before they are destroyed
+    if (IsStarted())
+    {
+        Flush();
+        Stop();
+    }
+}
+
+template <class... TFilters, class TLayout, class... TAppenders>
+inline bool StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>>::Start()
+{
+    // Start logging layout
+    if (!_layout.TLayout::IsStarted())
+        if (!_layout.TLayout::Start())
+            return false;
+
+    // Start logging filters and appenders
+    if (!_filters.Start() || !_appenders.Start())
+        return false;
+
+    // Start sub processors
+    return Processor::Start();
+}
+
+template <class... TFilters, class TLayout, class... TAppenders>
+inline bool StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>>::Stop()
+{
+    // Stop logging layout
+    if (_layout.TLayout::IsStarted())
+        if (!_layout.TLayout::Stop())
+            return false;
+
+    // Stop logging filters and appenders
+    if (!_filters.Stop() || !_appenders.Stop())
+        return false;
+
+    // Stop sub processors
+    return Processor::Stop();
+}
+
+template <class... TFilters, class TLayout, class... TAppenders>
+inline bool StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>>::FilterRecord(Record& record)
+{
+    // Filter the given logging record with static filters
+    return _filters.FilterRecord(record);
+}
+
+template <class... TFilters, class TLayout, class... TAppenders>
+inline bool StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>>::ProcessRecord(Record& record)
+{
+    // Check if the logging processor started
+    if (!IsStarted())
+        return true;
+
+    CppCommon::Locker<CppCommon::CriticalSection> locker(_lock);
+
+    // Filter the given logging record
+    if (!_filters.FilterRecord(record))
+        return true;
+
+    // Layout the given logging record
+    _layout.TLayout::LayoutRecord(record);
+
+    // Append the given logging record
+    _appenders.AppendRecord(record);
+
+    // Process the given logging record with sub processors
+    for (auto& processor : _processors)
+        if (processor && processor->IsStarted() && !processor->ProcessRecord(record))
+            return false;
+
+    return true;
+}
+
+template <class... TFilters, class TLayout, class... TAppenders>
+inline void StaticProcessor<Filters<TFilters...>, TLayout, Appenders<TAppenders...>>::Flush()
+{
+    // Check if the logging processor started
+    if (!IsStarted())
+        return;
+
+    CppCommon::Locker<CppCommon::CriticalSection> locker(_lock);
+
+    // Flush all appenders
+    _appenders.Flush();
+
+    // Flush all sub processors
+    for (auto& processor : _processors)
+        if (processor && processor->IsStarted())
+            processor->Flush();
+}
+
+} // namespace CppLogging
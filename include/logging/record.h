@@ -18,6 +18,8 @@
 
 namespace CppLogging {
 
+class Layout;
+
 //! Logging record
 /*!
     Logging record encapsulates all required fields in a single instance:
@@ -52,6 +54,18 @@ public:
     //! Record content after layout
     std::vector<uint8_t> raw;
 
+    //! Logging file generation of the record content
+    /*!
+        Layouts which keep the state per logging file (e.g. DictionaryLayout)
+        store the logging file generation they laid out the record content for
+        and themselves. File appenders open each logging file with the new
+        generation and lay out the record content once again with Relayout()
+        if it was laid out for another logging file.
+    */
+    uint64_t generation;
+    //! Layout which keeps the state per logging file
+    Layout* layout;
+
     Record();
     Record(const Record&) = default;
     Record(Record&&) = default;
@@ -91,12 +105,27 @@ public:
     //! Restore format of the custom data type
     static std::string RestoreFormat(std::string_view pattern, const std::vector<uint8_t>& buffer, size_t offset, size_t size);
 
+    //! Get the new unique logging file generation
+    static uint64_t NextGeneration() noexcept;
+    //! Lay out the record content once again for the given logging file generation
+    /*!
+         Does nothing if the record content does not depend on the logging file
+         or it was already laid out for the given logging file generation.
+
+         \param file_generation - Logging file generation
+    */
+    void Relayout(uint64_t file_generation)
+    { if ((layout != nullptr) && (generation != file_generation)) RelayoutRecord(file_generation); }
+
     //! Clear logging record
     void Clear();
 
     //! Swap two instances
     void swap(Record& record) noexcept;
     friend void swap(Record& record1, Record& record2) noexcept;
+
+private:
+    void RelayoutRecord(uint64_t file_generation);
 };
 
 } // namespace CppLogging
@@ -11,7 +11,9 @@ namespace CppLogging {
 inline Record::Record()
     : timestamp(CppCommon::Timestamp::utc()),
       thread(CppCommon::Thread::CurrentThreadId()),
-      level(Level::INFO)
+      level(Level::INFO),
+      generation(0),
+      layout(nullptr)
 {
     logger.reserve(32);
     message.reserve(512);
@@ -455,6 +457,8 @@ inline void Record::Clear()
     message.clear();
     buffer.clear();
     raw.clear();
+    generation = 0;
+    layout = nullptr;
 }
 
 inline void Record::swap(Record& record) noexcept
@@ -467,6 +471,8 @@ inline void Record::swap(Record& record) noexcept
     swap(message, record.message);
     swap(buffer, record.buffer);
     swap(raw, record.raw);
+    swap(generation, record.generation);
+    swap(layout, record.layout);
 }
 
 inline void swap(Record& record1, Record& record2) noexcept
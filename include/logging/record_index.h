@@ -0,0 +1,156 @@
+/*!
+    \file record_index.h
+    \brief Logging records index definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_RECORD_INDEX_H
+#define CPPLOGGING_RECORD_INDEX_H
+
+#include "logging/record.h"
+
+#include "filesystem/file.h"
+
+#include <string_view>
+#include <vector>
+
+namespace CppLogging {
+
+//! Logging records index
+/*!
+    Logging records index is a compact sidecar file (logging file name with
+    ".idx" suffix) which is written by file appenders along with the logging
+    file. Logging records are grouped into blocks of 'records' logging records
+    or 'bytes' bytes and each block is described by the index entry:
+    - timestamp of the first logging record in the block;
+    - minimal and maximal timestamps of logging records in the block;
+    - block offset and size in the logging file;
+    - logging records count;
+    - bitmap of logging levels;
+    - 64-bit bloom filter of logger names.
+
+    Index file starts with the magic "CLX1" followed by index entries. Entry
+    is written when its block is completed, so the tail of the logging file
+    which is not covered by index entries must be always read. Readers use
+    the index to skip blocks which cannot contain the requested logging
+    records by time range, logging level or logger name.
+
+    Not thread-safe.
+*/
+class RecordIndex
+{
+public:
+    //! Index file magic
+    static constexpr uint8_t MAGIC[4] = { 'C', 'L', 'X', '1' };
+    //! Index file header size
+    static constexpr size_t HEADER_SIZE = 4;
+    //! Index entry size
+    static constexpr size_t ENTRY_SIZE = 52;
+
+    //! Index entry
+    struct Entry
+    {
+        uint64_t timestamp; //!< Timestamp of the first logging record in the block
+        uint64_t first;     //!< Minimal timestamp of logging records in the block
+        uint64_t last;      //!< Maximal timestamp of logging records in the block
+        uint64_t offset;    //!< Block offset in the logging file
+        uint32_t size;      //!< Block size in bytes
+        uint32_t records;   //!< Logging records count in the block
+        uint32_t levels;    //!< Bitmap of logging levels in the block
+        uint64_t loggers;   //!< Bloom filter of logger names in the block
+    };
+
+    //! Initialize logging records index with a given block limits
+    /*!
+         \param records - Maximal logging records count in the block (default is 1024)
+         \param bytes - Maximal block size in bytes (default is 1048576)
+    */
+    explicit RecordIndex(size_t records = 1024, size_t bytes = 1048576);
+    RecordIndex(const RecordIndex&) = delete;
+    RecordIndex(RecordIndex&&) = delete;
+    ~RecordIndex();
+
+    RecordIndex& operator=(const RecordIndex&) = delete;
+    RecordIndex& operator=(RecordIndex&&) = delete;
+
+    //! Check if the index file is opened
+    explicit operator bool() const noexcept { return IsOpened(); }
+
+    //! Get the maximal logging records count in the block
+    size_t records() const noexcept { return _records; }
+    //! Get the maximal block size in bytes
+    size_t bytes() const noexcept { return _bytes; }
+
+    //! Is the index file opened?
+    bool IsOpened() const noexcept { return _index.IsFileWriteOpened(); }
+
+    //! Open the index file of the given logging file
+    /*!
+         Index file is truncated if the logging file is truncated or the index
+         file is corrupted. Otherwise new index entries are appended.
+
+         In case of any IO error the index is disabled until the next opening.
+
+         \param file - Logging file
+         \param offset - Current size of the logging file
+         \param truncate - Truncate flag
+    */
+    void Open(const CppCommon::Path& file, uint64_t offset, bool truncate);
+    //! Close the index file with the last incompleted block
+    void Close();
+
+    //! Update the index with the logging record appended into the logging file
+    /*!
+         \param record - Logging record
+         \param size - Size of the logging record in the logging file
+    */
+    void Update(const Record& record, size_t size);
+
+    //! Get the index file path of the given logging file
+    static CppCommon::Path IndexPath(const CppCommon::Path& file) { return file + ".idx"; }
+
+    //! Read index entries of the given logging file
+    /*!
+         Index entries which are out of the logging file size are skipped.
+
+         \param file - Logging file
+         \param entries - Index entries
+         \return 'true' if the index was successfully read, 'false' if the index file is missing or corrupted
+    */
+    static bool Read(const CppCommon::Path& file, std::vector<Entry>& entries);
+
+    //! Get the bit of the given logging level in the levels bitmap
+    static uint32_t LevelBits(Level level) noexcept { return 1u << ((uint8_t)level >> 5); }
+    //! Get the bits of all logging levels up to the given one in the levels bitmap
+    static uint32_t LevelMask(Level level) noexcept { return (LevelBits(level) << 1) - 1; }
+    //! Get the bits of the given logger name in the loggers bloom filter
+    static uint64_t LoggerBits(std::string_view logger) noexcept;
+
+    //! Check if the block of the given index entry may contain matching logging records
+    /*!
+         \param entry - Index entry
+         \param from - Minimal timestamp
+         \param to - Maximal timestamp
+         \param levels - Logging levels mask (see LevelMask())
+         \param loggers - Logger name bits (see LoggerBits()) or zero for any logger
+         \return 'true' if the block may contain matching logging records, 'false' if the block can be skipped
+    */
+    static bool Match(const Entry& entry, uint64_t from, uint64_t to, uint32_t levels, uint64_t loggers) noexcept
+    { return (entry.last >= from) && (entry.first <= to) && ((entry.levels & levels) != 0) && ((entry.loggers & loggers) == loggers); }
+
+private:
+    size_t _records;
+    size_t _bytes;
+    CppCommon::File _index;
+    Entry _entry{};
+    std::string _logger;
+    uint64_t _logger_bits{0};
+
+    void WriteEntry();
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_RECORD_INDEX_H
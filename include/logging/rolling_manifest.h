@@ -0,0 +1,165 @@
+/*!
+    \file rolling_manifest.h
+    \brief Rolling manifest definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_ROLLING_MANIFEST_H
+#define CPPLOGGING_ROLLING_MANIFEST_H
+
+#include "logging/record.h"
+
+#include "filesystem/path.h"
+#include "threads/critical_section.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace CppLogging {
+
+//! Rolling manifest
+/*!
+    Rolling manifest is an append-only file (".manifest" in the rolling
+    directory) which describes logging files produced by the rolling file
+    appender. Each rolled logging file is described by its filename, archive
+    state, first/last timestamps, logging records count, per-level logging
+    records counts and byte size, so readers are able to prune logging files
+    before opening them.
+
+    Manifest file starts with the magic "CLM1" followed by entries of 32-bit
+    entry size, entry type and entry content:
+    - file entry describes the logging file and replaces the previous one with
+      the same filename;
+    - rename entry renames the logging file of rolling backups;
+    - remove entry removes the logging file.
+
+    Filenames are relative to the rolling directory. The logging file which is
+    opened for writing is described with the opened state and its statistics
+    is written when the logging file is closed, rolled or archived.
+
+    Manifest file is replayed once and current logging file entries are kept
+    in memory. The torn tail of the manifest file is cut before the first
+    append and the manifest file is compacted when most of its entries are
+    obsolete.
+
+    Thread-safe.
+*/
+class RollingManifest
+{
+public:
+    //! Manifest file magic
+    static constexpr uint8_t MAGIC[4] = { 'C', 'L', 'M', '1' };
+    //! Manifest filename in the rolling directory
+    static constexpr const char* FILENAME = ".manifest";
+    //! Minimal count of manifest entries to compact the manifest file
+    static constexpr size_t COMPACT_ENTRIES = 1024;
+
+    //! Logging file state
+    enum class State : uint8_t
+    {
+        OPENED,     //!< Logging file is opened for writing
+        CLOSED,     //!< Logging file is closed
+        ARCHIVED    //!< Logging file is archived
+    };
+
+    //! Logging file entry
+    struct Entry
+    {
+        std::string filename;           //!< Logging filename relative to the rolling directory
+        State state{State::CLOSED};     //!< Logging file state
+        uint64_t first{0};              //!< Minimal timestamp of logging records
+        uint64_t last{0};               //!< Maximal timestamp of logging records
+        uint64_t records{0};            //!< Logging records count
+        uint64_t fatal{0};              //!< Fatal logging records count
+        uint64_t error{0};              //!< Error logging records count
+        uint64_t warn{0};               //!< Warning logging records count
+        uint64_t info{0};               //!< Information logging records count
+        uint64_t debug{0};              //!< Debug logging records count
+        uint64_t bytes{0};              //!< Size of logging records in bytes
+
+        //! Update the entry with the logging record written into the logging file
+        /*!
+             \param record - Logging record
+             \param size - Size of the logging record in the logging file
+        */
+        void Update(const Record& record, size_t size) noexcept;
+        //! Is statistics of logging records known?
+        /*!
+             Logging file statistics is unknown if the logging file is opened
+             for writing or it was not entirely written by the rolling file
+             appender with the manifest.
+        */
+        bool IsKnown() const noexcept { return (state != State::OPENED) && ((records > 0) || (bytes == 0)); }
+
+        //! Get the logging records count with the given level or more severe
+        uint64_t count(Level level) const noexcept;
+
+        //! Check if the logging file may contain logging records of the given time range and logging level
+        bool Match(uint64_t from, uint64_t to, Level level) const noexcept
+        { return !IsKnown() || ((last >= from) && (first <= to) && (count(level) > 0)); }
+    };
+
+    //! Initialize the rolling manifest of the given rolling directory
+    /*!
+         \param path - Rolling directory path
+    */
+    explicit RollingManifest(const CppCommon::Path& path);
+    RollingManifest(const RollingManifest&) = delete;
+    RollingManifest(RollingManifest&&) = delete;
+    ~RollingManifest() = default;
+
+    RollingManifest& operator=(const RollingManifest&) = delete;
+    RollingManifest& operator=(RollingManifest&&) = delete;
+
+    //! Get the manifest file path
+    const CppCommon::Path& path() const noexcept { return _path; }
+
+    //! Append the logging file entry
+    void Append(const Entry& entry);
+    //! Append the logging file rename entry
+    void Rename(const std::string& filename, const std::string& new_filename);
+    //! Append the logging file remove entry
+    void Remove(const std::string& filename);
+
+    //! Find the logging file entry by its filename
+    /*!
+         \param filename - Logging filename relative to the rolling directory
+         \param entry - Found logging file entry
+         \return 'true' if the logging file entry was found, 'false' if the logging file entry was not found
+    */
+    bool Find(const std::string& filename, Entry& entry);
+
+    //! Read the current logging file entries of the given rolling directory
+    /*!
+         Entries are replayed, so only entries of existing logging files are
+         returned sorted by the first timestamp. Entries with unknown
+         statistics are returned at the end.
+
+         \param path - Rolling directory path
+         \param entries - Logging file entries
+         \return 'true' if the manifest was successfully read, 'false' if the manifest file is missing or corrupted
+    */
+    static bool Read(const CppCommon::Path& path, std::vector<Entry>& entries);
+
+private:
+    CppCommon::CriticalSection _lock;
+    CppCommon::Path _path;
+    bool _loaded{false};
+    std::map<std::string, Entry> _files;
+    uint64_t _size{0};
+    size_t _entries{0};
+
+    //! Replay the manifest file into current logging file entries
+    void Load();
+    //! Append the manifest entry
+    void Write(const std::vector<uint8_t>& buffer);
+    //! Rewrite the manifest file with current logging file entries
+    void Compact();
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_ROLLING_MANIFEST_H
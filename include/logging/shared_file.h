@@ -0,0 +1,104 @@
+/*!
+    \file shared_file.h
+    \brief Shared file definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_SHARED_FILE_H
+#define CPPLOGGING_SHARED_FILE_H
+
+#include "filesystem/path.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppLogging {
+
+//! Shared file
+/*!
+    Shared file is the file opened for appending by several processes at
+    once. Each write is performed with a single system call on the file
+    opened in append mode (O_APPEND or FILE_APPEND_DATA), so the content
+    of each write is never interleaved with writes of other processes.
+
+    Processes coordinate with the advisory lock of the lock file next to
+    the shared file ('*.lock' file): writers hold the shared lock while
+    they write, and the process which rolls the shared file holds the
+    exclusive lock. The lock file is never renamed, so the lock survives
+    rolls of the shared file.
+
+    Not thread-safe.
+
+    \see FileAppender
+*/
+class SharedFile
+{
+public:
+    SharedFile() = default;
+    SharedFile(const SharedFile&) = delete;
+    SharedFile(SharedFile&&) = delete;
+    ~SharedFile() { Close(); }
+
+    SharedFile& operator=(const SharedFile&) = delete;
+    SharedFile& operator=(SharedFile&&) = delete;
+
+    //! Check if the file is opened
+    explicit operator bool() const noexcept { return IsOpened(); }
+
+    //! Get the shared file path
+    const CppCommon::Path& path() const noexcept { return _path; }
+    //! Get the current size of the opened file
+    uint64_t size() const;
+
+    //! Is the file opened?
+    bool IsOpened() const noexcept;
+    //! Is the opened file replaced with another file in its path (e.g. rolled by another process)?
+    bool IsReplaced() const;
+
+    //! Open the given shared file and its lock file
+    /*!
+         \param path - Shared file path
+    */
+    void Open(const CppCommon::Path& path);
+    //! Open the shared file again in its path keeping the lock file
+    void Reopen();
+    //! Close the shared file and its lock file
+    void Close();
+
+    //! Write the given buffer into the end of the shared file with a single system call
+    /*!
+         \param buffer - Buffer to write
+         \param size - Buffer size
+    */
+    void Write(const void* buffer, size_t size);
+
+    //! Lock the lock file
+    /*!
+         \param exclusive - Exclusive lock flag
+    */
+    void Lock(bool exclusive);
+    //! Unlock the lock file
+    void Unlock() noexcept;
+
+    //! Get the lock file path of the given shared file
+    static CppCommon::Path LockPath(const CppCommon::Path& path) { return CppCommon::Path(path.string() + ".lock"); }
+
+private:
+    CppCommon::Path _path;
+#if defined(_WIN32) || defined(_WIN64)
+    void* _file{nullptr};
+    void* _lock{nullptr};
+#else
+    int _file{-1};
+    int _lock{-1};
+#endif
+
+    void OpenFile();
+    void CloseFile();
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_SHARED_FILE_H
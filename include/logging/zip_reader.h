@@ -0,0 +1,83 @@
+/*!
+    \file zip_reader.h
+    \brief Zip archive reader definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPLOGGING_ZIP_READER_H
+#define CPPLOGGING_ZIP_READER_H
+
+#include "filesystem/path.h"
+#include "system/stream.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CppLogging {
+
+//! Zip archive reader
+/*!
+    Zip archive reader reads all files of the given zip archive one after
+    another as a single stream. Files are inflated in the read-ahead thread
+    into the limited number of buffers while the previous data is decoded.
+
+    Not thread-safe.
+
+    \see GzipReader
+*/
+class ZipReader : public CppCommon::Reader
+{
+public:
+    //! Size of the read-ahead buffer
+    static const size_t BUFFER_SIZE = 65536;
+    //! Maximal number of read-ahead buffers
+    static const size_t BUFFERS = 16;
+
+    //! Open the given zip archive and start the read-ahead thread
+    /*!
+         \param path - Zip archive path
+    */
+    explicit ZipReader(const CppCommon::Path& path);
+    ZipReader(const ZipReader&) = delete;
+    ZipReader(ZipReader&&) = delete;
+    ~ZipReader();
+
+    ZipReader& operator=(const ZipReader&) = delete;
+    ZipReader& operator=(ZipReader&&) = delete;
+
+    //! Read inflated data of the zip archive files
+    /*!
+         Rethrows the error of the read-ahead thread after all data inflated before it was read.
+
+         \param buffer - Buffer to read
+         \param size - Buffer size
+         \return Count of read bytes, less than the buffer size only at the end of the zip archive
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+private:
+    CppCommon::Path _path;
+    void* _unzf;
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<std::vector<uint8_t>> _buffers;
+    std::vector<uint8_t> _current;
+    size_t _offset{0};
+    std::exception_ptr _error;
+    bool _eof{false};
+    bool _stop{false};
+
+    //! Read-ahead thread handler
+    void ReadAheadThread();
+};
+
+} // namespace CppLogging
+
+#endif // CPPLOGGING_ZIP_READER_H
@@ -5,7 +5,9 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "logging/layouts/binary_layout.h"
+#include "logging/layouts/dictionary_layout.h"
 #include "logging/layouts/hash_layout.h"
+#include "logging/layouts/hash64_layout.h"
 #include "logging/layouts/text_layout.h"
 
 using namespace CppLogging;
@@ -36,6 +38,32 @@ BENCHMARK("HashLayout")
     context.metrics().AddBytes(record.raw.size());
 }
 
+BENCHMARK("DictionaryLayout")
+{
+    static DictionaryLayout layout;
+    static Record record;
+
+    record.Clear();
+    record.logger = "Test logger";
+    record.StoreFormat("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, "bin");
+
+    layout.LayoutRecord(record);
+    context.metrics().AddBytes(record.raw.size());
+}
+
+BENCHMARK("Hash64Layout")
+{
+    static Hash64Layout layout;
+    static Record record;
+
+    record.Clear();
+    record.logger = "Test logger";
+    record.StoreFormat("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, "bin");
+
+    layout.LayoutRecord(record);
+    context.metrics().AddBytes(record.raw.size());
+}
+
 BENCHMARK("TextLayout")
 {
     static TextLayout layout;
@@ -49,4 +77,26 @@ BENCHMARK("TextLayout")
     context.metrics().AddBytes(record.raw.size());
 }
 
+const std::string_view messages[] = { "Test logger", "Test {}.{}.{} message", "Test message with a longer format string {} and arguments {} to check {} hashing" };
+
+BENCHMARK("HashLayout::Hash")
+{
+    for (const auto& message : messages)
+    {
+        volatile uint32_t hash = HashLayout::Hash(message);
+        (void)hash;
+        context.metrics().AddBytes(message.size());
+    }
+}
+
+BENCHMARK("Hash64Layout::Hash")
+{
+    for (const auto& message : messages)
+    {
+        volatile uint64_t hash = Hash64Layout::Hash(message);
+        (void)hash;
+        context.metrics().AddBytes(message.size());
+    }
+}
+
 BENCHMARK_MAIN()
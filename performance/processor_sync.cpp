@@ -28,6 +28,27 @@ protected:
         sync_text_sink->appenders().push_back(std::make_shared<NullAppender>());
         Config::ConfigLogger("sync-text", sync_text_sink);
 
+        auto combining_null_sink = std::make_shared<FlatCombiningProcessor>(std::make_shared<NullLayout>());
+        combining_null_sink->appenders().push_back(std::make_shared<NullAppender>());
+        Config::ConfigLogger("combining-null", combining_null_sink);
+
+        auto combining_binary_sink = std::make_shared<FlatCombiningProcessor>(std::make_shared<BinaryLayout>());
+        combining_binary_sink->appenders().push_back(std::make_shared<NullAppender>());
+        Config::ConfigLogger("combining-binary", combining_binary_sink);
+
+        auto combining_text_sink = std::make_shared<FlatCombiningProcessor>(std::make_shared<TextLayout>());
+        combining_text_sink->appenders().push_back(std::make_shared<NullAppender>());
+        Config::ConfigLogger("combining-text", combining_text_sink);
+
+        auto static_null_sink = std::make_shared<StaticProcessor<Filters<>, NullLayout, Appenders<NullAppender>>>();
+        Config::ConfigLogger("static-null", static_null_sink);
+
+        auto static_binary_sink = std::make_shared<StaticProcessor<Filters<>, BinaryLayout, Appenders<NullAppender>>>();
+        Config::ConfigLogger("static-binary", static_binary_sink);
+
+        auto static_text_sink = std::make_shared<StaticProcessor<Filters<>, TextLayout, Appenders<NullAppender>>>();
+        Config::ConfigLogger("static-text", static_text_sink);
+
         Config::Startup();
     }
 };
@@ -50,4 +71,40 @@ BENCHMARK_THREADS_FIXTURE(LogConfigFixture, "SyncProcessor-text", settings)
     logger.Info("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
 }
 
+BENCHMARK_THREADS_FIXTURE(LogConfigFixture, "FlatCombiningProcessor-null", settings)
+{
+    thread_local Logger logger = Config::CreateLogger("combining-null");
+    logger.Info("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+}
+
+BENCHMARK_THREADS_FIXTURE(LogConfigFixture, "FlatCombiningProcessor-binary", settings)
+{
+    thread_local Logger logger = Config::CreateLogger("combining-binary");
+    logger.Info("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+}
+
+BENCHMARK_THREADS_FIXTURE(LogConfigFixture, "FlatCombiningProcessor-text", settings)
+{
+    thread_local Logger logger = Config::CreateLogger("combining-text");
+    logger.Info("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+}
+
+BENCHMARK_THREADS_FIXTURE(LogConfigFixture, "StaticProcessor-null", settings)
+{
+    thread_local Logger logger = Config::CreateLogger("static-null");
+    logger.Info("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+}
+
+BENCHMARK_THREADS_FIXTURE(LogConfigFixture, "StaticProcessor-binary", settings)
+{
+    thread_local Logger logger = Config::CreateLogger("static-binary");
+    logger.Info("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+}
+
+BENCHMARK_THREADS_FIXTURE(LogConfigFixture, "StaticProcessor-text", settings)
+{
+    thread_local Logger logger = Config::CreateLogger("static-text");
+    logger.Info("Test {}.{}.{} message", context.metrics().total_operations(), context.metrics().total_operations() / 1000.0, context.name());
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,781 @@
+/*!
+    \file block_file_appender.cpp
+    \brief Block-compressed file appender implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/appenders/block_file_appender.h"
+
+#include "logging/layouts/binary_layout_v2.h"
+#include "logging/layouts/hash_layout.h"
+
+#include "errors/exceptions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include <zlib.h>
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+struct BlockFileAppender::Deflater
+{
+    z_stream stream;
+
+    explicit Deflater(int level)
+    {
+        std::memset(&stream, 0, sizeof(stream));
+        if (deflateInit(&stream, level) != Z_OK)
+            throwex CppCommon::RuntimeException("Cannot initialize zlib deflate stream!");
+    }
+
+    ~Deflater()
+    {
+        deflateEnd(&stream);
+    }
+
+    size_t Compress(const std::vector<uint8_t>& source, std::vector<uint8_t>& destination)
+    {
+        destination.resize(deflateBound(&stream, (uLong)source.size()));
+
+        stream.next_in = (Bytef*)source.data();
+        stream.avail_in = (uInt)source.size();
+        stream.next_out = (Bytef*)destination.data();
+        stream.avail_out = (uInt)destination.size();
+
+        int result = deflate(&stream, Z_FINISH);
+        size_t size = destination.size() - stream.avail_out;
+        deflateReset(&stream);
+        if (result != Z_STREAM_END)
+            throwex CppCommon::RuntimeException("Cannot compress the block with zlib deflate!");
+
+        return size;
+    }
+};
+
+struct BlockFileAppender::Columns
+{
+    std::vector<uint64_t> timestamps;
+    std::vector<uint64_t> threads_dictionary;
+    std::unordered_map<uint64_t, uint32_t> threads_map;
+    std::vector<uint32_t> threads;
+    std::vector<Level> levels;
+    std::vector<std::string> loggers_dictionary;
+    std::unordered_map<std::string, uint32_t> loggers_map;
+    std::vector<uint32_t> loggers;
+    std::vector<std::string> messages_dictionary;
+    std::unordered_map<std::string, uint32_t> messages_map;
+    std::vector<uint32_t> messages;
+    std::vector<uint32_t> sizes;
+    std::vector<uint8_t> arguments;
+    size_t estimate{0};
+
+    void Clear()
+    {
+        timestamps.clear();
+        threads_dictionary.clear();
+        threads_map.clear();
+        threads.clear();
+        levels.clear();
+        loggers_dictionary.clear();
+        loggers_map.clear();
+        loggers.clear();
+        messages_dictionary.clear();
+        messages_map.clear();
+        messages.clear();
+        sizes.clear();
+        arguments.clear();
+        estimate = 0;
+    }
+
+    template <typename TKey, typename TValue>
+    uint32_t Lookup(std::unordered_map<TKey, uint32_t>& map, std::vector<TValue>& dictionary, const TKey& key, size_t size)
+    {
+        auto it = map.find(key);
+        if (it != map.end())
+            return it->second;
+
+        uint32_t index = (uint32_t)dictionary.size();
+        dictionary.emplace_back(key);
+        map.emplace(key, index);
+        estimate += size;
+        return index;
+    }
+
+    void Append(const Record& record)
+    {
+        timestamps.push_back(record.timestamp);
+        threads.push_back(Lookup(threads_map, threads_dictionary, record.thread, sizeof(uint64_t)));
+        levels.push_back(record.level);
+        loggers.push_back(Lookup(loggers_map, loggers_dictionary, record.logger, record.logger.size()));
+        messages.push_back(Lookup(messages_map, messages_dictionary, record.message, sizeof(uint32_t) + record.message.size()));
+        sizes.push_back((uint32_t)record.buffer.size());
+        arguments.insert(arguments.end(), record.buffer.begin(), record.buffer.end());
+        estimate += sizeof(uint32_t) + record.buffer.size();
+    }
+
+    static void WriteVarint(std::vector<uint8_t>& buffer, uint64_t value)
+    {
+        uint8_t varint[10];
+        size_t size = BinaryLayoutV2::WriteVarint(varint, value);
+        buffer.insert(buffer.end(), varint, varint + size);
+    }
+
+    static void WriteString(std::vector<uint8_t>& buffer, const std::string& value)
+    {
+        WriteVarint(buffer, value.size());
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    void Encode(std::vector<uint8_t>& buffer) const
+    {
+        const size_t count = timestamps.size();
+        const size_t directory = sizeof(uint32_t) + COLUMNS * sizeof(uint32_t);
+
+        buffer.clear();
+        buffer.resize(directory);
+        uint32_t value = (uint32_t)count;
+        std::memcpy(buffer.data(), &value, sizeof(uint32_t));
+
+        size_t column = 0;
+        size_t start = buffer.size();
+        auto finish = [&]()
+        {
+            uint32_t size = (uint32_t)(buffer.size() - start);
+            std::memcpy(buffer.data() + sizeof(uint32_t) + column++ * sizeof(uint32_t), &size, sizeof(uint32_t));
+            start = buffer.size();
+        };
+
+        // Timestamps column: first timestamp, delta and delta-of-delta values
+        if (count > 0)
+        {
+            buffer.insert(buffer.end(), (const uint8_t*)&timestamps[0], (const uint8_t*)&timestamps[0] + sizeof(uint64_t));
+            int64_t previous = 0;
+            for (size_t i = 1; i < count; ++i)
+            {
+                int64_t delta = (int64_t)(timestamps[i] - timestamps[i - 1]);
+                int64_t dod = delta - previous;
+                WriteVarint(buffer, ((uint64_t)dod << 1) ^ (uint64_t)(dod >> 63));
+                previous = delta;
+            }
+        }
+        finish();
+
+        // Threads column: dictionary and indexes
+        WriteVarint(buffer, threads_dictionary.size());
+        for (auto thread : threads_dictionary)
+            WriteVarint(buffer, thread);
+        for (auto index : threads)
+            WriteVarint(buffer, index);
+        finish();
+
+        // Levels column: run-length encoding
+        std::vector<std::pair<Level, size_t>> runs;
+        for (auto level : levels)
+        {
+            if (!runs.empty() && (runs.back().first == level))
+                ++runs.back().second;
+            else
+                runs.emplace_back(level, 1);
+        }
+        WriteVarint(buffer, runs.size());
+        for (auto& run : runs)
+        {
+            buffer.push_back((uint8_t)run.first);
+            WriteVarint(buffer, run.second);
+        }
+        finish();
+
+        // Loggers column: dictionary and indexes
+        WriteVarint(buffer, loggers_dictionary.size());
+        for (auto& logger : loggers_dictionary)
+            WriteString(buffer, logger);
+        for (auto index : loggers)
+            WriteVarint(buffer, index);
+        finish();
+
+        // Messages column: dictionary of hashed messages and indexes
+        WriteVarint(buffer, messages_dictionary.size());
+        for (auto& message : messages_dictionary)
+        {
+            uint32_t hash = HashLayout::Hash(message);
+            buffer.insert(buffer.end(), (const uint8_t*)&hash, (const uint8_t*)&hash + sizeof(uint32_t));
+            WriteString(buffer, message);
+        }
+        for (auto index : messages)
+            WriteVarint(buffer, index);
+        finish();
+
+        // Arguments column: sizes and payloads
+        for (auto size : sizes)
+            WriteVarint(buffer, size);
+        buffer.insert(buffer.end(), arguments.begin(), arguments.end());
+        finish();
+    }
+
+    //! Columns count
+    static constexpr size_t COLUMNS = 6;
+};
+
+//! @endcond
+
+BlockFileAppender::BlockFileAppender(const CppCommon::Path& file, bool truncate, size_t block_size, int level, BlockEncoding encoding, bool auto_start, const CppCommon::Timespan& max_age)
+    : _file(file), _truncate(truncate), _block_size(block_size), _level(level), _encoding(encoding), _max_age(max_age)
+{
+    assert((block_size > 0) && "Block size should be greater than zero!");
+    if (block_size == 0)
+        throwex CppCommon::ArgumentException("Block size should be greater than zero!");
+
+    assert(((level >= 1) && (level <= 9)) && "Compression level should be in range from 1 to 9!");
+    if ((level < 1) || (level > 9))
+        throwex CppCommon::ArgumentException("Compression level should be in range from 1 to 9!");
+
+    _block.reserve(block_size);
+    if (_encoding == BlockEncoding::COLUMNS)
+        _columns = std::make_unique<Columns>();
+
+    // Start the block file appender
+    if (auto_start)
+        Start();
+}
+
+BlockFileAppender::~BlockFileAppender()
+{
+    // Stop the block file appender
+    if (IsStarted())
+        Stop();
+}
+
+bool BlockFileAppender::Start()
+{
+    if (IsStarted())
+        return false;
+
+    _deflater = std::make_unique<Deflater>(_level);
+    PrepareFile();
+    _started = true;
+    return true;
+}
+
+bool BlockFileAppender::Stop()
+{
+    if (!IsStarted())
+        return false;
+
+    CloseFile();
+    _deflater.reset();
+    _started = false;
+    return true;
+}
+
+void BlockFileAppender::AppendRecord(Record& record)
+{
+    // Skip logging records without layout
+    if (record.raw.empty() && (_encoding == BlockEncoding::ROWS))
+        return;
+
+    if (PrepareFile())
+    {
+        // Try to append logging record content into the current block
+        try
+        {
+            if (_encoding == BlockEncoding::COLUMNS)
+            {
+                // Append logging record fields into block columns
+                _columns->Append(record);
+                _first = (_records == 0) ? record.timestamp : std::min(_first, record.timestamp);
+                _last = (_records == 0) ? record.timestamp : std::max(_last, record.timestamp);
+                ++_records;
+
+                if ((_columns->estimate >= _block_size) || IsExpired(record.timestamp))
+                    WriteBlock();
+                return;
+            }
+
+            // Lay out the logging record once again if it was laid out for another logging file
+            record.Relayout(_generation);
+
+            size_t size = record.raw.size() - 1;
+
+            // Logging records are never split between blocks
+            if (!_block.empty() && ((_block.size() + size) > _block_size))
+                WriteBlock();
+
+            _block.insert(_block.end(), record.raw.data(), record.raw.data() + size);
+            _first = (_records == 0) ? record.timestamp : std::min(_first, record.timestamp);
+            _last = (_records == 0) ? record.timestamp : std::max(_last, record.timestamp);
+            ++_records;
+
+            if ((_block.size() >= _block_size) || IsExpired(record.timestamp))
+                WriteBlock();
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            // Try to close the opened file in case of any IO error
+            CloseFile();
+        }
+    }
+}
+
+void BlockFileAppender::Flush()
+{
+    if (PrepareFile())
+    {
+        // Try to write the expired partial block and flush the opened file.
+        // Complete blocks are already written, the partial one waits for more logging records.
+        try
+        {
+            if (IsExpired(CppCommon::Timestamp::utc()))
+                WriteBlock();
+            _file.Flush();
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            // Try to close the opened file in case of any IO error
+            CloseFile();
+        }
+    }
+}
+
+bool BlockFileAppender::ParseBlockHeader(const uint8_t* buffer, uint32_t& compressed, uint32_t& raw, uint32_t& records, uint64_t& first, uint64_t& last, uint32_t& crc)
+{
+    if (std::memcmp(buffer, BLOCK_MAGIC, sizeof(BLOCK_MAGIC)) != 0)
+        return false;
+
+    uint32_t header_crc;
+    std::memcpy(&header_crc, buffer + 36, sizeof(uint32_t));
+    if (header_crc != BinaryLayoutV2::CRC32C(buffer, 36))
+        return false;
+
+    std::memcpy(&compressed, buffer + 4, sizeof(uint32_t));
+    std::memcpy(&raw, buffer + 8, sizeof(uint32_t));
+    std::memcpy(&records, buffer + 12, sizeof(uint32_t));
+    std::memcpy(&first, buffer + 16, sizeof(uint64_t));
+    std::memcpy(&last, buffer + 24, sizeof(uint64_t));
+    std::memcpy(&crc, buffer + 32, sizeof(uint32_t));
+    return true;
+}
+
+uint64_t BlockFileAppender::ReadIndex(CppCommon::File& file, std::vector<BlockIndex>& index, BlockEncoding* encoding)
+{
+    index.clear();
+
+    // Validate the block file header
+    uint64_t size = file.size();
+    if (size < FILE_HEADER_SIZE)
+        return 0;
+    uint8_t header[FILE_HEADER_SIZE];
+    file.Seek(0);
+    if ((file.Read(header, sizeof(header)) != sizeof(header)) || (std::memcmp(header, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) || (header[4] != VERSION))
+        return 0;
+    if (encoding != nullptr)
+        *encoding = (BlockEncoding)header[5];
+
+    // Try to read the block index from the trailer
+    if (size >= (FILE_HEADER_SIZE + TRAILER_SIZE))
+    {
+        uint8_t trailer[TRAILER_SIZE];
+        file.Seek(size - TRAILER_SIZE);
+        if ((file.Read(trailer, sizeof(trailer)) == sizeof(trailer)) && (std::memcmp(trailer, TRAILER_MAGIC, sizeof(TRAILER_MAGIC)) == 0))
+        {
+            uint64_t offset;
+            std::memcpy(&offset, trailer + 4, sizeof(uint64_t));
+
+            uint8_t index_header[8];
+            file.Seek(offset);
+            if ((offset >= FILE_HEADER_SIZE) && (offset < size) && (file.Read(index_header, sizeof(index_header)) == sizeof(index_header)) && (std::memcmp(index_header, INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0))
+            {
+                uint32_t count;
+                std::memcpy(&count, index_header + 4, sizeof(uint32_t));
+
+                // Validate the block index size before allocating its entries, because the count might be corrupted
+                uint64_t entries_size = (uint64_t)count * INDEX_ENTRY_SIZE + sizeof(uint32_t);
+                if ((offset + sizeof(index_header) + entries_size + TRAILER_SIZE) == size)
+                {
+                    std::vector<uint8_t> entries((size_t)entries_size);
+                    if (file.Read(entries.data(), entries.size()) == entries.size())
+                    {
+                        uint32_t crc;
+                        std::memcpy(&crc, entries.data() + count * INDEX_ENTRY_SIZE, sizeof(uint32_t));
+                        if (crc == BinaryLayoutV2::CRC32C(entries.data(), count * INDEX_ENTRY_SIZE))
+                        {
+                            index.resize(count);
+                            for (size_t i = 0; i < count; ++i)
+                                std::memcpy(&index[i], entries.data() + i * INDEX_ENTRY_SIZE, INDEX_ENTRY_SIZE);
+
+                            // Appended blocks will replace the block index and the trailer
+                            return offset;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Restore the block index by scanning block headers
+    uint64_t offset = FILE_HEADER_SIZE;
+    while ((offset + BLOCK_HEADER_SIZE) <= size)
+    {
+        uint8_t block[BLOCK_HEADER_SIZE];
+        file.Seek(offset);
+        if (file.Read(block, sizeof(block)) != sizeof(block))
+            break;
+
+        uint32_t compressed, raw, records, crc;
+        uint64_t first, last;
+        if (!ParseBlockHeader(block, compressed, raw, records, first, last, crc))
+            break;
+        if ((offset + BLOCK_HEADER_SIZE + compressed) > size)
+            break;
+
+        index.push_back({ first, last, offset });
+        offset += BLOCK_HEADER_SIZE + compressed;
+    }
+
+    return offset;
+}
+
+bool BlockFileAppender::DecodeColumns(const uint8_t* data, size_t size, std::vector<Record>& records)
+{
+    records.clear();
+
+    // Read the column directory
+    const size_t directory = sizeof(uint32_t) + Columns::COLUMNS * sizeof(uint32_t);
+    if (size < directory)
+        return false;
+    uint32_t count;
+    std::memcpy(&count, data, sizeof(uint32_t));
+    const uint8_t* columns[Columns::COLUMNS];
+    size_t sizes[Columns::COLUMNS];
+    size_t offset = directory;
+    for (size_t i = 0; i < Columns::COLUMNS; ++i)
+    {
+        uint32_t column_size;
+        std::memcpy(&column_size, data + sizeof(uint32_t) + i * sizeof(uint32_t), sizeof(uint32_t));
+        if (column_size > (size - offset))
+            return false;
+        columns[i] = data + offset;
+        sizes[i] = column_size;
+        offset += column_size;
+    }
+
+    // Every logging record takes at least one byte of the arguments column
+    if (count > sizes[5])
+        return false;
+
+    // Column reader with bounds checks
+    const uint8_t* buffer = nullptr;
+    size_t remaining = 0;
+    auto varint = [&](uint64_t& value)
+    {
+        size_t read = BinaryLayoutV2::ReadVarint(buffer, remaining, value);
+        buffer += read;
+        remaining -= read;
+        return (read > 0);
+    };
+    auto string = [&](std::string& value)
+    {
+        uint64_t length;
+        if (!varint(length) || (length > remaining))
+            return false;
+        value.assign((const char*)buffer, (size_t)length);
+        buffer += length;
+        remaining -= (size_t)length;
+        return true;
+    };
+    auto index = [&](size_t dictionary, uint64_t& value)
+    {
+        return varint(value) && (value < dictionary);
+    };
+
+    records.resize(count);
+
+    // Decode the timestamps column
+    buffer = columns[0];
+    remaining = sizes[0];
+    if (count > 0)
+    {
+        if (remaining < sizeof(uint64_t))
+            return false;
+        uint64_t timestamp;
+        std::memcpy(&timestamp, buffer, sizeof(uint64_t));
+        buffer += sizeof(uint64_t);
+        remaining -= sizeof(uint64_t);
+        records[0].timestamp = timestamp;
+        int64_t delta = 0;
+        for (size_t i = 1; i < count; ++i)
+        {
+            uint64_t zigzag;
+            if (!varint(zigzag))
+                return false;
+            delta += (int64_t)((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+            timestamp += (uint64_t)delta;
+            records[i].timestamp = timestamp;
+        }
+    }
+
+    // Decode the threads column
+    buffer = columns[1];
+    remaining = sizes[1];
+    uint64_t dictionary_size;
+    if (!varint(dictionary_size) || (dictionary_size > remaining))
+        return false;
+    std::vector<uint64_t> threads((size_t)dictionary_size);
+    for (auto& thread : threads)
+        if (!varint(thread))
+            return false;
+    for (auto& record : records)
+    {
+        uint64_t value;
+        if (!index(threads.size(), value))
+            return false;
+        record.thread = threads[(size_t)value];
+    }
+
+    // Decode the levels column
+    buffer = columns[2];
+    remaining = sizes[2];
+    uint64_t runs;
+    if (!varint(runs))
+        return false;
+    size_t position = 0;
+    for (uint64_t i = 0; i < runs; ++i)
+    {
+        if (remaining < 1)
+            return false;
+        Level level = (Level)*buffer++;
+        --remaining;
+        uint64_t length;
+        if (!varint(length) || (length > (count - position)))
+            return false;
+        for (uint64_t j = 0; j < length; ++j)
+            records[position++].level = level;
+    }
+    if (position != count)
+        return false;
+
+    // Decode the loggers column
+    buffer = columns[3];
+    remaining = sizes[3];
+    if (!varint(dictionary_size) || (dictionary_size > remaining))
+        return false;
+    std::vector<std::string> loggers((size_t)dictionary_size);
+    for (auto& logger : loggers)
+        if (!string(logger))
+            return false;
+    for (auto& record : records)
+    {
+        uint64_t value;
+        if (!index(loggers.size(), value))
+            return false;
+        record.logger = loggers[(size_t)value];
+    }
+
+    // Decode the messages column
+    buffer = columns[4];
+    remaining = sizes[4];
+    if (!varint(dictionary_size) || (dictionary_size > remaining))
+        return false;
+    std::vector<std::string> messages((size_t)dictionary_size);
+    for (auto& message : messages)
+    {
+        // Skip the message hash which is used by tools to filter messages without decoding them
+        if (remaining < sizeof(uint32_t))
+            return false;
+        buffer += sizeof(uint32_t);
+        remaining -= sizeof(uint32_t);
+        if (!string(message))
+            return false;
+    }
+    for (auto& record : records)
+    {
+        uint64_t value;
+        if (!index(messages.size(), value))
+            return false;
+        record.message = messages[(size_t)value];
+    }
+
+    // Decode the arguments column
+    buffer = columns[5];
+    remaining = sizes[5];
+    std::vector<uint64_t> arguments(count);
+    for (auto& argument : arguments)
+        if (!varint(argument))
+            return false;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (arguments[i] > remaining)
+            return false;
+        records[i].buffer.assign(buffer, buffer + arguments[i]);
+        buffer += arguments[i];
+        remaining -= (size_t)arguments[i];
+    }
+
+    return true;
+}
+
+bool BlockFileAppender::PrepareFile()
+{
+    try
+    {
+        // 1. Check if the file is already opened for writing
+        if (_file.IsFileWriteOpened())
+            return true;
+
+        // 2. Check retry timestamp if 100ms elapsed after the last attempt
+        if ((CppCommon::Timestamp::utc() - _retry).milliseconds() < 100)
+            return false;
+
+        // 3. If the file is opened for reading close it
+        if (_file.IsFileReadOpened())
+            _file.Close();
+
+        // 4. Restore the block index of the existing block file
+        uint64_t offset = 0;
+        if (!_truncate && _file.IsFileExists())
+        {
+            CppCommon::File file(_file);
+            file.Open(true, false);
+            BlockEncoding encoding = _encoding;
+            offset = ReadIndex(file, _index, &encoding);
+            file.Close();
+
+            // Block file with another encoding will be truncated
+            if (encoding != _encoding)
+                offset = 0;
+        }
+
+        // 5. Open the file for writing
+        _file.OpenOrCreate(false, true, (offset == 0));
+
+        if (offset == 0)
+        {
+            // 6. Write the block file header into the new file
+            uint8_t header[FILE_HEADER_SIZE] = {};
+            std::memcpy(header, FILE_MAGIC, sizeof(FILE_MAGIC));
+            header[4] = VERSION;
+            header[5] = (uint8_t)_encoding;
+            uint32_t block_size = (uint32_t)_block_size;
+            std::memcpy(header + 8, &block_size, sizeof(uint32_t));
+            _file.Write(header, sizeof(header));
+            _index.clear();
+            _offset = FILE_HEADER_SIZE;
+        }
+        else
+        {
+            // 6. Truncate the torn tail or the previous block index and continue to append blocks
+            _file.Resize(offset);
+            _file.Seek(offset);
+            _offset = offset;
+        }
+
+        // 7. Start the new logging file generation
+        _generation = Record::NextGeneration();
+
+        // 8. Reset the the retry timestamp
+        _retry = 0;
+
+        return true;
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        // In case of any IO error reset the retry timestamp and return false!
+        _retry = CppCommon::Timestamp::utc();
+        return false;
+    }
+}
+
+bool BlockFileAppender::CloseFile()
+{
+    try
+    {
+        if (_file)
+        {
+            // Write the current block
+            WriteBlock();
+
+            // Write the block index
+            std::vector<uint8_t> index(8 + _index.size() * INDEX_ENTRY_SIZE + sizeof(uint32_t));
+            uint32_t count = (uint32_t)_index.size();
+            std::memcpy(index.data(), INDEX_MAGIC, sizeof(INDEX_MAGIC));
+            std::memcpy(index.data() + 4, &count, sizeof(uint32_t));
+            for (size_t i = 0; i < _index.size(); ++i)
+                std::memcpy(index.data() + 8 + i * INDEX_ENTRY_SIZE, &_index[i], INDEX_ENTRY_SIZE);
+            uint32_t crc = BinaryLayoutV2::CRC32C(index.data() + 8, _index.size() * INDEX_ENTRY_SIZE);
+            std::memcpy(index.data() + 8 + _index.size() * INDEX_ENTRY_SIZE, &crc, sizeof(uint32_t));
+            _file.Write(index.data(), index.size());
+
+            // Write the trailer
+            uint8_t trailer[TRAILER_SIZE];
+            std::memcpy(trailer, TRAILER_MAGIC, sizeof(TRAILER_MAGIC));
+            std::memcpy(trailer + 4, &_offset, sizeof(uint64_t));
+            _file.Write(trailer, sizeof(trailer));
+
+            _file.Close();
+        }
+        return true;
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        // Drop the current block in case of any IO error
+        _block.clear();
+        if (_columns)
+            _columns->Clear();
+        _records = 0;
+        if (_file)
+            _file.Close();
+        return false;
+    }
+}
+
+void BlockFileAppender::WriteBlock()
+{
+    if (_records == 0)
+        return;
+
+    // Encode block columns
+    if (_encoding == BlockEncoding::COLUMNS)
+    {
+        _columns->Encode(_block);
+        _columns->Clear();
+    }
+
+    // Compress the current block
+    size_t compressed = _deflater->Compress(_block, _compressed);
+
+    // Prepare the block header
+    uint8_t header[BLOCK_HEADER_SIZE];
+    uint32_t compressed_size = (uint32_t)compressed;
+    uint32_t raw_size = (uint32_t)_block.size();
+    uint32_t crc = BinaryLayoutV2::CRC32C(_compressed.data(), compressed);
+    std::memcpy(header, BLOCK_MAGIC, sizeof(BLOCK_MAGIC));
+    std::memcpy(header + 4, &compressed_size, sizeof(uint32_t));
+    std::memcpy(header + 8, &raw_size, sizeof(uint32_t));
+    std::memcpy(header + 12, &_records, sizeof(uint32_t));
+    std::memcpy(header + 16, &_first, sizeof(uint64_t));
+    std::memcpy(header + 24, &_last, sizeof(uint64_t));
+    std::memcpy(header + 32, &crc, sizeof(uint32_t));
+    uint32_t header_crc = BinaryLayoutV2::CRC32C(header, 36);
+    std::memcpy(header + 36, &header_crc, sizeof(uint32_t));
+
+    // Reset the current block before writing to avoid duplicates after IO errors
+    _block.clear();
+    _records = 0;
+
+    // Write the block into the file
+    _file.Write(header, sizeof(header));
+    _file.Write(_compressed.data(), compressed);
+
+    // Update the block index
+    _index.push_back({ _first, _last, _offset });
+    _offset += BLOCK_HEADER_SIZE + compressed;
+}
+
+} // namespace CppLogging
@@ -0,0 +1,153 @@
+/*!
+    \file compressed_file_appender.cpp
+    \brief Compressed file appender implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/appenders/compressed_file_appender.h"
+
+namespace CppLogging {
+
+CompressedFileAppender::CompressedFileAppender(const CppCommon::Path& file, bool truncate, bool auto_flush, bool auto_start, int level, size_t sync)
+    : _file(file), _truncate(truncate), _auto_flush(auto_flush), _gzip(level, sync)
+{
+    // Start the compressed file appender
+    if (auto_start)
+        Start();
+}
+
+CompressedFileAppender::~CompressedFileAppender()
+{
+    // Stop the compressed file appender
+    if (IsStarted())
+        Stop();
+}
+
+bool CompressedFileAppender::Start()
+{
+    if (IsStarted())
+        return false;
+
+    PrepareFile();
+    _started = true;
+    return true;
+}
+
+bool CompressedFileAppender::Stop()
+{
+    if (!IsStarted())
+        return false;
+
+    CloseFile();
+    _started = false;
+    return true;
+}
+
+void CompressedFileAppender::AppendRecord(Record& record)
+{
+    // Skip logging records without layout
+    if (record.raw.empty())
+        return;
+
+    if (PrepareFile())
+    {
+        // Lay out the logging record once again if it was laid out for another logging file
+        record.Relayout(_generation);
+
+        // Try to deflate logging record content into the opened file
+        try
+        {
+            _gzip.Write(record.raw.data(), record.raw.size() - 1);
+
+            // Perform auto-flush if enabled
+            if (_auto_flush)
+                _gzip.Flush();
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            // Try to close the opened file in case of any IO error
+            CloseFile();
+        }
+    }
+}
+
+void CompressedFileAppender::Flush()
+{
+    if (PrepareFile())
+    {
+        // Try to sync the deflate stream and flush the opened file
+        try
+        {
+            _gzip.Flush();
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            // Try to close the opened file in case of any IO error
+            CloseFile();
+        }
+    }
+}
+
+bool CompressedFileAppender::PrepareFile()
+{
+    try
+    {
+        // 1. Check if the file is already opened for writing
+        if (_file.IsFileWriteOpened())
+            return true;
+
+        // 2. Check retry timestamp if 100ms elapsed after the last attempt
+        if ((CppCommon::Timestamp::utc() - _retry).milliseconds() < 100)
+            return false;
+
+        // 3. If the file is opened for reading close it
+        if (_file.IsFileReadOpened())
+            _file.Close();
+
+        // 4. Open the file for writing
+        _file.OpenOrCreate(false, true, _truncate);
+
+        // 5. Start a new gzip member
+        _gzip.Open(_file);
+
+        // 6. Start the new logging file generation
+        _generation = Record::NextGeneration();
+
+        // 7. Reset the the retry timestamp
+        _retry = 0;
+
+        return true;
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        // In case of any IO error reset the retry timestamp and return false!
+        _retry = CppCommon::Timestamp::utc();
+        return false;
+    }
+}
+
+bool CompressedFileAppender::CloseFile()
+{
+    bool result = true;
+
+    // Finish the gzip member
+    try
+    {
+        _gzip.Close();
+    }
+    catch (const CppCommon::FileSystemException&) { result = false; }
+
+    // Close the file
+    try
+    {
+        if (_file)
+            _file.Close();
+    }
+    catch (const CppCommon::FileSystemException&) { result = false; }
+
+    return result;
+}
+
+} // namespace CppLogging
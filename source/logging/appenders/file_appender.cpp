@@ -8,11 +8,24 @@
 
 #include "logging/appenders/file_appender.h"
 
+#include "errors/exceptions.h"
+#include "utility/resource.h"
+
+#include <cassert>
+#include <string>
+
 namespace CppLogging {
 
-FileAppender::FileAppender(const CppCommon::Path& file, bool truncate, bool auto_flush, bool auto_start)
-    : _file(file), _truncate(truncate), _auto_flush(auto_flush)
+FileAppender::FileAppender(const CppCommon::Path& file, bool truncate, bool auto_flush, bool auto_start, bool index, const SharedPolicy& shared)
+    : _file(file), _truncate(truncate && !shared.enabled), _auto_flush(auto_flush), _indexed(index && !shared.enabled), _shared(shared)
 {
+    assert((!shared.enabled || (shared.size == 0) || (shared.backups > 0)) && "Backups count should be greater than zero!");
+    if (shared.enabled && (shared.size > 0) && (shared.backups == 0))
+        throwex CppCommon::ArgumentException("Backups count should be greater than zero!");
+
+    if (_shared.enabled)
+        _batch.reserve(SHARED_BATCH_SIZE);
+
     // Start the file appender
     if (auto_start)
         Start();
@@ -40,6 +53,10 @@ bool FileAppender::Stop()
     if (!IsStarted())
         return false;
 
+    // Write the pending batch into the shared file
+    if (_shared.enabled && PrepareFile())
+        WriteBatch();
+
     CloseFile();
     _started = false;
     return true;
@@ -53,10 +70,34 @@ void FileAppender::AppendRecord(Record& record)
 
     if (PrepareFile())
     {
+        // Lay out the logging record once again if it was laid out for another logging file
+        record.Relayout(_generation);
+
+        if (_shared.enabled)
+        {
+            size_t size = record.raw.size() - 1;
+
+            // Logging records are never split between batches
+            if (!_batch.empty() && ((_batch.size() + size) > SHARED_BATCH_SIZE))
+                WriteBatch();
+
+            _batch.insert(_batch.end(), record.raw.data(), record.raw.data() + size);
+
+            // Perform auto-flush if enabled
+            if (_auto_flush || (_batch.size() >= SHARED_BATCH_SIZE))
+                WriteBatch();
+            return;
+        }
+
         // Try to write logging record content into the opened file
         try
         {
-            _file.Write(record.raw.data(), record.raw.size() - 1);
+            size_t size = record.raw.size() - 1;
+            _file.Write(record.raw.data(), size);
+
+            // Update the logging records index
+            if (_indexed)
+                _index.Update(record, size);
 
             // Perform auto-flush if enabled
             if (_auto_flush)
@@ -74,6 +115,13 @@ void FileAppender::Flush()
 {
     if (PrepareFile())
     {
+        // Write the pending batch into the shared file
+        if (_shared.enabled)
+        {
+            WriteBatch();
+            return;
+        }
+
         // Try to flush the opened file
         try
         {
@@ -92,7 +140,7 @@ bool FileAppender::PrepareFile()
     try
     {
         // 1. Check if the file is already opened for writing
-        if (_file.IsFileWriteOpened())
+        if (_shared.enabled ? _shared_file.IsOpened() : _file.IsFileWriteOpened())
             return true;
 
         // 2. Check retry timestamp if 100ms elapsed after the last attempt
@@ -104,11 +152,21 @@ bool FileAppender::PrepareFile()
             _file.Close();
 
         // 4. Open the file for writing
-        _file.OpenOrCreate(false, true, _truncate);
+        if (_shared.enabled)
+            _shared_file.Open(_file);
+        else
+            _file.OpenOrCreate(false, true, _truncate);
 
-        // 5. Reset the the retry timestamp
+        // 5. Open the logging records index
+        if (_indexed)
+            _index.Open(_file, _file.size(), _truncate);
+
+        // 6. Reset the the retry timestamp
         _retry = 0;
 
+        // 7. Start the new logging file generation
+        _generation = Record::NextGeneration();
+
         return true;
     }
     catch (const CppCommon::FileSystemException&)
@@ -123,11 +181,77 @@ bool FileAppender::CloseFile()
 {
     try
     {
+        if (_indexed)
+            _index.Close();
         if (_file)
             _file.Close();
+        _shared_file.Close();
         return true;
     }
     catch (const CppCommon::FileSystemException&) { return false; }
 }
 
+void FileAppender::WriteBatch()
+{
+    if (_batch.empty())
+        return;
+
+    // Try to write the batch into the shared file with a single write system call
+    try
+    {
+        if (_shared.size > 0)
+        {
+            // Hold the shared lock, so the shared file is never rolled between the size check and the write
+            _shared_file.Lock(false);
+            auto lock = CppCommon::resource(&_shared_file, [](SharedFile* file) { file->Unlock(); });
+
+            // Roll the shared file over the size limit
+            if (_shared_file.size() >= _shared.size)
+            {
+                _shared_file.Unlock();
+                RollShared();
+                _shared_file.Lock(false);
+            }
+
+            _shared_file.Write(_batch.data(), _batch.size());
+        }
+        else
+            _shared_file.Write(_batch.data(), _batch.size());
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        // Try to close the opened file in case of any IO error
+        CloseFile();
+    }
+
+    _batch.clear();
+}
+
+void FileAppender::RollShared()
+{
+    _shared_file.Lock(true);
+    auto lock = CppCommon::resource(&_shared_file, [](SharedFile* file) { file->Unlock(); });
+
+    // Skip rolling if the shared file was already rolled by another process
+    if (!_shared_file.IsReplaced() && (_shared_file.size() >= _shared.size))
+    {
+        // Shift backups: "file.log" -> "file.1.log" -> "file.2.log" ... and remove the oldest one
+        auto backup = [this](size_t index) { return _file.parent() / (_file.stem().string() + "." + std::to_string(index) + _file.extension().string()); };
+        for (size_t i = _shared.backups; i > 0; --i)
+        {
+            CppCommon::File src((i > 1) ? backup(i - 1) : _file);
+            CppCommon::File dst(backup(i));
+            if (src.IsFileExists())
+            {
+                if (dst.IsFileExists())
+                    CppCommon::File::Remove(dst);
+                CppCommon::File::Rename(src, dst);
+            }
+        }
+    }
+
+    // Open the new shared file
+    _shared_file.Reopen();
+}
+
 } // namespace CppLogging
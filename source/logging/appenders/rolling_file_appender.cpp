@@ -8,8 +8,17 @@
 
 #include "logging/appenders/rolling_file_appender.h"
 
+#include "logging/date_cache.h"
+#include "logging/gzip_writer.h"
+#include "logging/mapped_file.h"
+#include "logging/record_index.h"
+#include "logging/rolling_manifest.h"
+
 #include "errors/fatal.h"
+#include "filesystem/symlink.h"
 #include "string/format.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
 #include "threads/thread.h"
 #include "threads/wait_queue.h"
 #include "time/timezone.h"
@@ -22,21 +31,128 @@
 #include "minizip/iowin32.h"
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <regex>
+#include <vector>
+
+#include <zlib.h>
 
 namespace CppLogging {
 
 //! @cond INTERNALS
 
+// Archivation settings, compression workers and statistics
+struct ArchiveContext
+{
+    size_t threads;
+    int level;
+    std::vector<std::thread> workers;
+    std::unique_ptr<CppCommon::WaitQueue<std::function<void()>>> jobs;
+
+    std::atomic<uint64_t> archived{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> compressed{0};
+    std::atomic<uint64_t> last_time{0};
+    std::atomic<uint64_t> max_time{0};
+    std::atomic<uint64_t> total_time{0};
+
+    ArchiveContext(size_t t, int l) : threads(t), level(l) {}
+};
+
+// Next logging file opened in background
+struct PreparedFile
+{
+    CppCommon::CriticalSection lock;
+    std::shared_ptr<CppCommon::File> file;
+    bool pending{false};
+};
+
+// Retention policy with the inventory of rolled logging files cached by the archivation thread
+struct RetentionContext
+{
+    struct Entry
+    {
+        uint64_t size;
+        uint64_t timestamp;
+    };
+
+    RetentionPolicy policy;
+    bool scanned{false};
+    std::map<std::string, Entry> inventory;
+
+    CppCommon::CriticalSection lock;
+    CppCommon::Path current;
+
+    explicit RetentionContext(const RetentionPolicy& p) : policy(p) {}
+};
+
+// Raw deflate stream of the archived file chunk
+struct ArchiveChunk
+{
+    std::vector<uint8_t> data;
+    uLong crc;
+    size_t size;
+};
+
 class RollingFileAppender::Impl
 {
 public:
     static const std::string ARCHIVE_EXTENSION;
+    static const size_t ARCHIVE_CHUNK_SIZE = 1048576;
+    static const size_t ARCHIVE_WINDOW_SIZE = 32768;
 
-    Impl(RollingFileAppender& appender, const CppCommon::Path& path, bool archive, bool truncate, bool auto_flush, bool auto_start)
+    Impl(RollingFileAppender& appender, const CppCommon::Path& path, bool archive, bool truncate, bool auto_flush, bool auto_start, const RollingOptions& options, bool background)
         : _appender(appender), _path(path), _archive(archive), _truncate(truncate), _auto_flush(auto_flush)
     {
+        assert(!(archive && options.compress) && "Archivation and inline compression cannot be enabled together!");
+        if (archive && options.compress)
+            throwex CppCommon::ArgumentException("Archivation and inline compression cannot be enabled together!");
+
+        assert((options.archive_threads > 0) && "Archivation threads count should be greater than zero!");
+        if (options.archive_threads == 0)
+            throwex CppCommon::ArgumentException("Archivation threads count should be greater than zero!");
+
+        assert(((options.archive_level >= Z_DEFAULT_COMPRESSION) && (options.archive_level <= Z_BEST_COMPRESSION)) && "Archivation compression level should be in range [-1, 9]!");
+        if ((options.archive_level < Z_DEFAULT_COMPRESSION) || (options.archive_level > Z_BEST_COMPRESSION))
+            throwex CppCommon::ArgumentException("Archivation compression level should be in range [-1, 9]!");
+
+        // Create the inline gzip stream writer
+        if (options.compress)
+            _gzip = std::make_unique<GzipWriter>(options.archive_level, options.compress_sync);
+
+        // Create the archivation context, the archivation thread also works in background without archivation
+        if (_archive || background || options.preopen || options.retention.enabled())
+            _archive_context = std::make_unique<ArchiveContext>(options.archive_threads, options.archive_level);
+
+        // Create the next logging file prepared in background
+        if (options.preopen)
+            _prepared = std::make_unique<PreparedFile>();
+
+        // Create the retention policy context
+        if (options.retention.enabled())
+            _retention = std::make_unique<RetentionContext>(options.retention);
+
+        // Create the logging records index
+        if (options.index && !options.compress)
+            _index = std::make_unique<RecordIndex>();
+
+        // Create the rolling manifest
+        if (options.manifest)
+        {
+            _manifest = std::make_unique<RollingManifest>(path);
+            _stats = std::make_unique<RollingManifest::Entry>();
+        }
+
         // Start the rolling file appender
         if (auto_start)
             Start();
@@ -56,7 +172,11 @@ public:
         if (IsStarted())
             return false;
 
-        if (_archive)
+        // Scan the logging path for rolled files again, it could be changed while the appender was stopped
+        if (_retention)
+            _retention->scanned = false;
+
+        if (_archive_context)
             ArchivationStart();
 
         _started = true;
@@ -70,9 +190,18 @@ public:
 
         CloseFile();
 
-        if (_archive)
+        if (_archive_context)
             ArchivationStop();
 
+        // Discard the next logging file prepared in background
+        if (_prepared)
+        {
+            if (_prepared->file)
+                DiscardPrepared(*_prepared->file);
+            _prepared->file.reset();
+            _prepared->pending = false;
+        }
+
         _started = false;
         return true;
     }
@@ -80,6 +209,22 @@ public:
     virtual void AppendRecord(Record& record) = 0;
     virtual void Flush() = 0;
 
+    RollingFileAppender::ArchiveStats GetArchiveStats() const
+    {
+        RollingFileAppender::ArchiveStats stats;
+        if (_archive_context)
+        {
+            stats.queue = _archive_queue.size();
+            stats.archived = _archive_context->archived;
+            stats.bytes = _archive_context->bytes;
+            stats.compressed = _archive_context->compressed;
+            stats.last_time = _archive_context->last_time;
+            stats.max_time = _archive_context->max_time;
+            stats.total_time = _archive_context->total_time;
+        }
+        return stats;
+    }
+
 protected:
     RollingFileAppender& _appender;
     CppCommon::Path _path;
@@ -91,6 +236,441 @@ protected:
     CppCommon::Timestamp _retry{0};
     CppCommon::File _file;
     size_t _written{0};
+    std::unique_ptr<RecordIndex> _index;
+    std::unique_ptr<RollingManifest> _manifest;
+    std::unique_ptr<RollingManifest::Entry> _stats;
+    std::unique_ptr<GzipWriter> _gzip;
+    std::unique_ptr<PreparedFile> _prepared;
+    std::unique_ptr<RetentionContext> _retention;
+    uint64_t _generation{0};
+
+    void RelayoutRecord(Record& record, size_t& size)
+    {
+        // Lay out the logging record once again if it was laid out for another logging file
+        record.Relayout(_generation);
+        size = record.raw.size() - 1;
+    }
+
+    CppCommon::Path StreamPath(const CppCommon::Path& path) const
+    {
+        return _gzip ? (path + ".gz") : path;
+    }
+
+    void OpenStream()
+    {
+        if (_gzip)
+            _gzip->Open(_file);
+    }
+
+    void WriteStream(const void* buffer, size_t size)
+    {
+        if (_gzip)
+            _gzip->Write(buffer, size);
+        else
+            _file.Write(buffer, size);
+    }
+
+    void FlushStream()
+    {
+        if (_gzip)
+            _gzip->Flush();
+        else
+            _file.Flush();
+    }
+
+    void CloseStream()
+    {
+        if (_gzip)
+            _gzip->Close();
+        _file.Flush();
+    }
+
+    void CloseRolledFile(bool background)
+    {
+        if (_gzip)
+            _gzip->Close();
+
+        if (background && _prepared)
+        {
+            // Hand the rolled file over to the archivation thread to flush & close it
+            ArchiveItem item;
+            item.file = std::make_shared<CppCommon::File>(std::move(_file));
+            _file = CppCommon::Path(*item.file);
+            _archive_queue.Enqueue(item);
+        }
+        else
+        {
+            _file.Flush();
+            _file.Close();
+        }
+
+        CloseIndex();
+    }
+
+    void PrepareNext(const CppCommon::Path& path)
+    {
+        if (!_prepared)
+            return;
+
+        {
+            CppCommon::Locker<CppCommon::CriticalSection> locker(_prepared->lock);
+            if (_prepared->pending || (_prepared->file && (*_prepared->file == path)))
+                return;
+            _prepared->pending = true;
+        }
+
+        // Open the next logging file in the archivation thread
+        QueueJob([this, path]() { OpenPrepared(path); });
+    }
+
+    bool TakePrepared(const CppCommon::Path& path)
+    {
+        if (!_prepared)
+            return false;
+
+        std::shared_ptr<CppCommon::File> file;
+        {
+            CppCommon::Locker<CppCommon::CriticalSection> locker(_prepared->lock);
+            std::swap(file, _prepared->file);
+        }
+        if (!file)
+            return false;
+
+        // Swap the prepared file handle if the next logging file was predicted correctly
+        if (*file == path)
+        {
+            _file = std::move(*file);
+            if (_truncate)
+                _file.Resize(0);
+            return true;
+        }
+
+        // Discard the mispredicted logging file in the archivation thread
+        QueueJob([this, file]() { DiscardPrepared(*file); });
+        return false;
+    }
+
+    void OpenPrepared(const CppCommon::Path& path)
+    {
+        auto file = std::make_shared<CppCommon::File>(path);
+        try
+        {
+            // Prepared file is truncated when it is taken, so the file opened in the logging thread is never truncated here
+            CppCommon::Directory::CreateTree(file->parent());
+            file->OpenOrCreate(false, true, false);
+        }
+        catch (const CppCommon::FileSystemException&) { file.reset(); }
+
+        std::shared_ptr<CppCommon::File> stale;
+        {
+            CppCommon::Locker<CppCommon::CriticalSection> locker(_prepared->lock);
+            std::swap(stale, _prepared->file);
+            _prepared->file = file;
+            _prepared->pending = false;
+        }
+        if (stale)
+            DiscardPrepared(*stale);
+    }
+
+    static void DiscardPrepared(CppCommon::File& file)
+    {
+        try
+        {
+            // Remove the prepared logging file if nothing was written into it
+            bool empty = (file.size() == 0);
+            file.Close();
+            if (empty)
+                CppCommon::File::Remove(file);
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    static void CloseRolled(CppCommon::File& file)
+    {
+        try
+        {
+            file.Flush();
+            file.Close();
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    void OpenIndex()
+    {
+        if (_index)
+            _index->Open(_file, _file.size(), _truncate);
+    }
+
+    void UpdateIndex(const Record& record, size_t size)
+    {
+        if (_index)
+            _index->Update(record, size);
+    }
+
+    void CloseIndex()
+    {
+        if (_index)
+            _index->Close();
+    }
+
+    static void RenameIndex(const CppCommon::Path& src, const CppCommon::Path& dst)
+    {
+        CppCommon::File index(RecordIndex::IndexPath(src));
+        if (index.IsFileExists())
+            CppCommon::File::Rename(index, RecordIndex::IndexPath(dst));
+    }
+
+    static void RemoveIndex(const CppCommon::Path& path)
+    {
+        CppCommon::File index(RecordIndex::IndexPath(path));
+        if (index.IsFileExists())
+            CppCommon::File::Remove(index);
+    }
+
+    virtual std::string RetentionPattern() const = 0;
+
+    static std::string EscapePattern(const std::string& value)
+    {
+        // Escape regular expression characters and match any path separator as '/'
+        std::string result;
+        for (char ch : value)
+        {
+            if ((ch == '/') || (ch == '\\'))
+                result += '/';
+            else
+            {
+                if (std::strchr("^$.|?*+()[]{}", ch) != nullptr)
+                    result += '\\';
+                result += ch;
+            }
+        }
+        return result;
+    }
+
+    void OpenRetention()
+    {
+        if (!_retention)
+            return;
+
+        // Protect the current logging file from removal
+        {
+            CppCommon::Locker<CppCommon::CriticalSection> locker(_retention->lock);
+            _retention->current = _file;
+        }
+
+        // Apply the retention policy in the archivation thread
+        QueueJob([this]() { ApplyRetention(); });
+    }
+
+    void RetainFile(const CppCommon::Path& path)
+    {
+        // Append the rolled file into the inventory in the archivation thread
+        if (_retention)
+            QueueJob([this, path]() { AppendRetention(path); });
+    }
+
+    void AppendRetention(const CppCommon::Path& path, uint64_t timestamp = 0)
+    {
+        // Skip if the inventory will be scanned anyway
+        if (!_retention || !_retention->scanned)
+            return;
+
+        try
+        {
+            CppCommon::File file(path);
+            if (file.IsFileExists())
+                _retention->inventory[file.string()] = RetentionContext::Entry{ file.size(), (timestamp > 0) ? timestamp : file.modified().total() };
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    void RemoveRetention(const CppCommon::Path& path)
+    {
+        if (_retention)
+            _retention->inventory.erase(path.string());
+    }
+
+    void ScanRetention()
+    {
+        _retention->inventory.clear();
+        _retention->scanned = true;
+
+        CppCommon::Directory directory(_path);
+        if (!directory.IsDirectoryExists())
+            return;
+
+        // Find rolled logging files and archives by the logging pattern
+        std::regex pattern(RetentionPattern() + "(\\.gz)?(\\." + ARCHIVE_EXTENSION + ")?");
+        for (const auto& file : directory.GetFilesRecursive())
+        {
+            std::string name = RelativePath(file);
+            std::replace(name.begin(), name.end(), '\\', '/');
+            if (std::regex_match(name, pattern))
+                _retention->inventory[file.string()] = RetentionContext::Entry{ file.size(), file.modified().total() };
+        }
+    }
+
+    void ApplyRetention()
+    {
+        if (!_retention)
+            return;
+
+        try
+        {
+            if (!_retention->scanned)
+                ScanRetention();
+
+            // Never remove the current logging file and the next one prepared in background
+            std::string current;
+            {
+                CppCommon::Locker<CppCommon::CriticalSection> locker(_retention->lock);
+                current = _retention->current.string();
+            }
+            std::string prepared;
+            if (_prepared)
+            {
+                CppCommon::Locker<CppCommon::CriticalSection> locker(_prepared->lock);
+                if (_prepared->file)
+                    prepared = _prepared->file->string();
+            }
+
+            // Sort rolled logging files and archives from the oldest to the newest
+            std::vector<std::pair<std::string, RetentionContext::Entry>> files;
+            uint64_t total = 0;
+            for (const auto& file : _retention->inventory)
+            {
+                if ((file.first == current) || (file.first == prepared))
+                    continue;
+                files.push_back(file);
+                total += file.second.size;
+            }
+            std::sort(files.begin(), files.end(), [](const auto& a, const auto& b)
+            {
+                return (a.second.timestamp < b.second.timestamp) || ((a.second.timestamp == b.second.timestamp) && (a.first < b.first));
+            });
+
+            // Remove the oldest files while any retention limit is exceeded
+            const RetentionPolicy& policy = _retention->policy;
+            uint64_t timestamp = CppCommon::Timestamp::utc();
+            size_t count = files.size();
+            for (const auto& file : files)
+            {
+                bool expired = (policy.age.total() > 0) && ((file.second.timestamp + policy.age.total()) < timestamp);
+                bool exceeded = ((policy.files > 0) && (count > policy.files)) || ((policy.bytes > 0) && (total > policy.bytes));
+                if (!expired && !exceeded)
+                    break;
+
+                RemoveRetained(file.first);
+                total -= file.second.size;
+                --count;
+            }
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    void RemoveRetained(const CppCommon::Path& path)
+    {
+        try
+        {
+            CppCommon::File file(path);
+            if (file.IsFileExists())
+                CppCommon::File::Remove(file);
+            RemoveIndex(file);
+            RemoveManifest(file);
+        }
+        catch (const CppCommon::FileSystemException&) {}
+        RemoveRetention(path);
+    }
+
+    std::string RelativePath(const CppCommon::Path& path) const
+    {
+        std::string root = _path.string();
+        std::string result = path.string();
+        if (result.compare(0, root.size(), root) == 0)
+        {
+            result.erase(0, root.size());
+            result.erase(0, result.find_first_not_of("/\\"));
+        }
+        return result;
+    }
+
+    void OpenManifest()
+    {
+        if (!_manifest)
+            return;
+
+        try
+        {
+            // Continue statistics of the existing logging file if it is entirely described by the manifest
+            *_stats = RollingManifest::Entry();
+            uint64_t size = _file.size();
+            if (size > 0)
+            {
+                RollingManifest::Entry entry;
+                if (_manifest->Find(RelativePath(_file), entry) && entry.IsKnown() && (entry.bytes == size))
+                    *_stats = entry;
+                else
+                    _stats->bytes = size;
+            }
+
+            // Describe the logging file as opened for writing
+            RollingManifest::Entry opened;
+            opened.filename = RelativePath(_file);
+            opened.state = RollingManifest::State::OPENED;
+            _manifest->Append(opened);
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    void UpdateManifest(const Record& record, size_t size)
+    {
+        if (_stats)
+            _stats->Update(record, size);
+    }
+
+    RollingManifest::Entry ManifestStats() const
+    {
+        return _stats ? *_stats : RollingManifest::Entry();
+    }
+
+    void AppendManifest(const CppCommon::Path& path, RollingManifest::State state, const RollingManifest::Entry& stats)
+    {
+        if (!_manifest)
+            return;
+
+        try
+        {
+            RollingManifest::Entry entry = stats;
+            entry.filename = RelativePath(path);
+            entry.state = state;
+            _manifest->Append(entry);
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    void RenameManifest(const CppCommon::Path& src, const CppCommon::Path& dst)
+    {
+        if (!_manifest)
+            return;
+
+        try
+        {
+            _manifest->Rename(RelativePath(src), RelativePath(dst));
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    void RemoveManifest(const CppCommon::Path& path)
+    {
+        if (!_manifest)
+            return;
+
+        try
+        {
+            _manifest->Remove(RelativePath(path));
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
 
     bool CloseFile()
     {
@@ -100,38 +680,61 @@ protected:
             if (_file.IsFileWriteOpened())
             {
                 // Flush & close the file
-                _file.Flush();
+                CloseStream();
                 _file.Close();
+                CloseIndex();
 
-                // Archive the file
+                // Archive the file or describe it in the manifest
                 if (_archive)
                     ArchiveQueue(_file);
+                else
+                    AppendManifest(_file, RollingManifest::State::CLOSED, ManifestStats());
             }
             return true;
         }
         catch (const CppCommon::FileSystemException&) { return false; }
     }
 
+    // Rolled file to archive with its manifest statistics, rolled file to flush & close or background job
+    struct ArchiveItem
+    {
+        CppCommon::Path path;
+        RollingManifest::Entry stats;
+        std::shared_ptr<CppCommon::File> file{};
+        std::function<void()> job{};
+    };
+
     std::thread _archive_thread;
-    CppCommon::WaitQueue<CppCommon::Path> _archive_queue;
+    CppCommon::WaitQueue<ArchiveItem> _archive_queue;
+    std::unique_ptr<ArchiveContext> _archive_context;
+
+    void QueueJob(const std::function<void()>& job)
+    {
+        ArchiveItem item;
+        item.job = job;
+        _archive_queue.Enqueue(item);
+    }
 
     virtual void ArchiveQueue(const CppCommon::Path& path)
     {
-        _archive_queue.Enqueue(path);
+        _archive_queue.Enqueue(ArchiveItem{ path, ManifestStats() });
     }
 
-    virtual void ArchiveFile(const CppCommon::Path& path, const CppCommon::Path& filename)
+    virtual void ArchiveFile(const CppCommon::Path& path, const CppCommon::Path& filename, const RollingManifest::Entry& stats)
     {
         CppCommon::File file(path);
+        CppCommon::File archive(file + ".zip");
+        uint64_t modified = _retention ? file.modified().total() : 0;
+        uint64_t timestamp = CppCommon::Timestamp::nano();
 
         // Create a new zip archive
         zipFile zf;
 #if defined(_WIN32) || defined(_WIN64)
         zlib_filefunc64_def ffunc;
         fill_win32_filefunc64W(&ffunc);
-        zf = zipOpen2_64((file + ".zip").wstring().c_str(), APPEND_STATUS_CREATE, nullptr, &ffunc);
+        zf = zipOpen2_64(archive.wstring().c_str(), APPEND_STATUS_CREATE, nullptr, &ffunc);
 #else
-        zf = zipOpen64((file + ".zip").string().c_str(), APPEND_STATUS_CREATE);
+        zf = zipOpen64(archive.string().c_str(), APPEND_STATUS_CREATE);
 #endif
         if (zf == nullptr)
             throwex CppCommon::FileSystemException("Cannot create a new zip archive!").Attach(file);
@@ -139,16 +742,66 @@ protected:
         // Smart resource cleaner pattern
         auto zip = CppCommon::resource(zf, [](zipFile handle) { zipClose(handle, nullptr); });
 
+        // Compress large files in parallel with archivation workers
+        std::string name = filename.empty() ? file.filename().string() : filename.string();
+        MappedFile source;
+        uint64_t size;
+        if (!_archive_context->workers.empty() && source.Map(file) && (source.size() > ARCHIVE_CHUNK_SIZE))
+        {
+            size = source.size();
+            ArchiveParallel(zf, name, source);
+            source.Unmap();
+        }
+        else
+        {
+            source.Unmap();
+            size = ArchiveSequential(zf, name, file);
+        }
+
+        // Close zip archive
+        int result = zipClose(zf, nullptr);
+        if (result != ZIP_OK)
+            throwex CppCommon::FileSystemException("Cannot close a zip archive!").Attach(file);
+        zip.release();
+
+        // Update archivation statistics
+        uint64_t time = CppCommon::Timestamp::nano() - timestamp;
+        _archive_context->archived += 1;
+        _archive_context->bytes += size;
+        _archive_context->compressed += archive.size();
+        _archive_context->last_time = time;
+        _archive_context->max_time = std::max(_archive_context->max_time.load(), time);
+        _archive_context->total_time += time;
+
+        // Remove the source file and its index which is not valid for the archive
+        CppCommon::File::Remove(file);
+        RemoveIndex(file);
+
+        // Describe the archive in the manifest
+        RemoveManifest(file);
+        AppendManifest(archive, RollingManifest::State::ARCHIVED, stats);
+
+        // Replace the rolled file with the archive of the same age in the retention inventory
+        RemoveRetention(file);
+        AppendRetention(archive, modified);
+
+        // Call archive file handler
+        _appender.onArchiveFile(archive, CppCommon::Timespan((int64_t)time));
+    }
+
+    uint64_t ArchiveSequential(zipFile zf, const std::string& name, const CppCommon::Path& path)
+    {
         // Open a new file in zip archive
-        int result = zipOpenNewFileInZip64(zf, filename.empty() ? file.filename().string().c_str() : filename.string().c_str(), nullptr, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, Z_DEFAULT_COMPRESSION, 1);
+        int result = zipOpenNewFileInZip64(zf, name.c_str(), nullptr, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, _archive_context->level, 1);
         if (result != ZIP_OK)
-            throwex CppCommon::FileSystemException("Cannot open a new file in zip archive!").Attach(file);
+            throwex CppCommon::FileSystemException("Cannot open a new file in zip archive!").Attach(path);
 
         // Smart resource cleaner pattern
         auto zip_file = CppCommon::resource(zf, [](zipFile handle) { zipCloseFileInZip(handle); });
 
-        CppCommon::File source(file);
+        CppCommon::File source(path);
         uint8_t buffer[16384];
+        uint64_t total = 0;
         size_t size;
 
         // Open the source file for reading
@@ -162,7 +815,8 @@ protected:
             {
                 result = zipWriteInFileInZip(zf, buffer, (unsigned)size);
                 if (result != ZIP_OK)
-                    throwex CppCommon::FileSystemException("Cannot write into the zip file!").Attach(file);
+                    throwex CppCommon::FileSystemException("Cannot write into the zip file!").Attach(path);
+                total += size;
             }
         } while (size > 0);
 
@@ -172,21 +826,119 @@ protected:
         // Close the file in zip archive
         result = zipCloseFileInZip(zf);
         if (result != ZIP_OK)
-            throwex CppCommon::FileSystemException("Cannot close a file in zip archive!").Attach(file);
+            throwex CppCommon::FileSystemException("Cannot close a file in zip archive!").Attach(path);
         zip_file.release();
 
-        // Close zip archive
-        result = zipClose(zf, nullptr);
+        return total;
+    }
+
+    void ArchiveParallel(zipFile zf, const std::string& name, const MappedFile& source)
+    {
+        // Open a new raw file in zip archive to write deflated chunks as is
+        int result = zipOpenNewFileInZip2_64(zf, name.c_str(), nullptr, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, _archive_context->level, 1, 1);
         if (result != ZIP_OK)
-            throwex CppCommon::FileSystemException("Cannot close a zip archive!").Attach(file);
-        zip.release();
+            throwex CppCommon::FileSystemException("Cannot open a new file in zip archive!").Attach(source.path());
+
+        const uint8_t* data = source.data();
+        size_t size = source.size();
+        int level = _archive_context->level;
+        size_t window = 2 * _archive_context->threads;
+
+        std::deque<std::future<ArchiveChunk>> pending;
+        uLong crc = crc32(0, nullptr, 0);
+
+        try
+        {
+            for (size_t offset = 0; (offset < size) || !pending.empty();)
+            {
+                // Deflate chunks on archivation workers. Each chunk is primed with the previous 32 KB of data.
+                while ((offset < size) && (pending.size() < window))
+                {
+                    size_t chunk = std::min(ARCHIVE_CHUNK_SIZE, size - offset);
+                    size_t dictionary = std::min(offset, ARCHIVE_WINDOW_SIZE);
+                    bool last = ((offset + chunk) == size);
+                    auto task = std::make_shared<std::packaged_task<ArchiveChunk()>>([=]() { return DeflateChunk(data + offset, chunk, data + offset - dictionary, dictionary, last, level); });
+                    pending.push_back(task->get_future());
+                    if (!_archive_context->jobs->Enqueue([task]() { (*task)(); }))
+                        (*task)();
+                    offset += chunk;
+                }
 
-        // Remove the source file
-        CppCommon::File::Remove(source);
+                // Write deflated chunks in order
+                ArchiveChunk chunk = pending.front().get();
+                pending.pop_front();
+                result = zipWriteInFileInZip(zf, chunk.data.data(), (unsigned)chunk.data.size());
+                if (result != ZIP_OK)
+                    throwex CppCommon::FileSystemException("Cannot write into the zip file!").Attach(source.path());
+                crc = crc32_combine(crc, chunk.crc, (z_off_t)chunk.size);
+            }
+        }
+        catch (...)
+        {
+            // Wait for all pending chunks before the source file is unmapped
+            for (auto& future : pending)
+                future.wait();
+            zipCloseFileInZipRaw64(zf, 0, 0);
+            throw;
+        }
+
+        // Close the raw file in zip archive with the size and CRC32 of the source file
+        result = zipCloseFileInZipRaw64(zf, size, crc);
+        if (result != ZIP_OK)
+            throwex CppCommon::FileSystemException("Cannot close a file in zip archive!").Attach(source.path());
+    }
+
+    static ArchiveChunk DeflateChunk(const uint8_t* data, size_t size, const uint8_t* dictionary, size_t dictionary_size, bool last, int level)
+    {
+        z_stream stream;
+        std::memset(&stream, 0, sizeof(stream));
+        if (deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throwex CppCommon::RuntimeException("Cannot initialize zlib deflate stream!");
+
+        // Smart resource cleaner pattern
+        auto deflater = CppCommon::resource(&stream, [](z_stream* handle) { deflateEnd(handle); });
+
+        if ((dictionary_size > 0) && (deflateSetDictionary(&stream, dictionary, (uInt)dictionary_size) != Z_OK))
+            throwex CppCommon::RuntimeException("Cannot set zlib deflate dictionary!");
+
+        ArchiveChunk chunk;
+        chunk.crc = crc32(0, data, (uInt)size);
+        chunk.size = size;
+        chunk.data.resize(deflateBound(&stream, (uLong)size) + 16);
+
+        // Non-last chunks are finished with the sync flush to be concatenated into a single deflate stream
+        stream.next_in = (Bytef*)data;
+        stream.avail_in = (uInt)size;
+        int flush = last ? Z_FINISH : Z_SYNC_FLUSH;
+        size_t written = 0;
+        int result;
+        do
+        {
+            if (written == chunk.data.size())
+                chunk.data.resize(chunk.data.size() * 2);
+            stream.next_out = (Bytef*)chunk.data.data() + written;
+            stream.avail_out = (uInt)(chunk.data.size() - written);
+            result = deflate(&stream, flush);
+            written = chunk.data.size() - stream.avail_out;
+        } while ((result == Z_OK) && (stream.avail_out == 0));
+
+        if (result != (last ? Z_STREAM_END : Z_OK))
+            throwex CppCommon::RuntimeException("Cannot compress the archived file chunk with zlib deflate!");
+
+        chunk.data.resize(written);
+        return chunk;
     }
 
     void ArchivationStart()
     {
+        // Start archivation workers to compress large files in parallel
+        if (_archive_context->threads > 1)
+        {
+            _archive_context->jobs = std::make_unique<CppCommon::WaitQueue<std::function<void()>>>();
+            for (size_t i = 0; i < _archive_context->threads; ++i)
+                _archive_context->workers.emplace_back(CppCommon::Thread::Start([this]() { ArchivationWorker(); }));
+        }
+
         // Start archivation thread
         _archive_thread = CppCommon::Thread::Start([this]() { ArchivationThread(); });
     }
@@ -196,6 +948,28 @@ protected:
         // Stop archivation thread
         _archive_queue.Close();
         _archive_thread.join();
+
+        // Stop archivation workers
+        if (_archive_context->jobs)
+            _archive_context->jobs->Close();
+        for (auto& worker : _archive_context->workers)
+            worker.join();
+        _archive_context->workers.clear();
+        _archive_context->jobs.reset();
+    }
+
+    void ArchivationWorker()
+    {
+        // Call initialize archivation thread handler
+        _appender.onArchiveThreadInitialize();
+
+        // Compression errors are reported to the archivation thread
+        std::function<void()> job;
+        while (_archive_context->jobs->Dequeue(job))
+            job();
+
+        // Call cleanup archivation thread handler
+        _appender.onArchiveThreadCleanup();
     }
 
     void ArchivationThread()
@@ -205,9 +979,17 @@ protected:
 
         try
         {
-            CppCommon::Path path;
-            while (_archive_queue.Dequeue(path))
-                ArchiveFile(path, "");
+            ArchiveItem item;
+            while (_archive_queue.Dequeue(item))
+            {
+                if (item.job)
+                    item.job();
+                else if (item.file)
+                    CloseRolled(*item.file);
+                // Rolled file could be already removed by the retention policy
+                else if (!_retention || CppCommon::File(item.path).IsFileExists())
+                    ArchiveFile(item.path, "", item.stats);
+            }
         }
         catch (const std::exception& ex)
         {
@@ -262,8 +1044,8 @@ class TimePolicyImpl : public RollingFileAppender::Impl
     };
 
 public:
-    TimePolicyImpl(RollingFileAppender& appender, const CppCommon::Path& path, TimeRollingPolicy policy, const std::string& pattern, bool archive, bool truncate, bool auto_flush, bool auto_start)
-        : RollingFileAppender::Impl(appender, path, archive, truncate, auto_flush, auto_start),
+    TimePolicyImpl(RollingFileAppender& appender, const CppCommon::Path& path, TimeRollingPolicy policy, const std::string& pattern, bool archive, bool truncate, bool auto_flush, bool auto_start, const RollingOptions& options)
+        : RollingFileAppender::Impl(appender, path, archive, truncate, auto_flush, auto_start, options, false),
           _policy(policy), _pattern(pattern)
     {
         std::string placeholder;
@@ -311,22 +1093,10 @@ public:
         else
             AppendPattern(subpattern);
 
-        // Calculate rolling delay
-        switch (policy)
-        {
-            case TimeRollingPolicy::SECOND:
-                _rolldelay = 1000000000ull;
-                break;
-            case TimeRollingPolicy::MINUTE:
-                _rolldelay = 60 * 1000000000ull;
-                break;
-            case TimeRollingPolicy::HOUR:
-                _rolldelay = 60 * 60 * 1000000000ull;
-                break;
-            default:
-                _rolldelay = 24 * 60 * 60 * 1000000000ull;
-                break;
-        }
+        // Calculate rolling boundaries in local time if the pattern contains local date & time placeholders
+        for (const auto& placeholder : _placeholders)
+            if (placeholder.type >= PlaceholderType::LocalDateTime)
+                _local = true;
     }
 
     virtual ~TimePolicyImpl()
@@ -351,15 +1121,21 @@ public:
 
         if (PrepareFile(record.timestamp))
         {
+            RelayoutRecord(record, size);
+
             // Try to write logging record content into the opened file
             try
             {
-                _file.Write(record.raw.data(), size);
+                WriteStream(record.raw.data(), size);
                 _written += size;
 
+                // Update the logging records index and the manifest statistics
+                UpdateIndex(record, size);
+                UpdateManifest(record, size);
+
                 // Perform auto-flush if enabled
                 if (_auto_flush)
-                    _file.Flush();
+                    FlushStream();
             }
             catch (const CppCommon::FileSystemException&)
             {
@@ -380,7 +1156,7 @@ public:
             // Try to flush the opened file
             try
             {
-                _file.Flush();
+                FlushStream();
             }
             catch (const CppCommon::FileSystemException&)
             {
@@ -395,11 +1171,44 @@ public:
     }
 
 private:
+    // Date & time strings of logging filenames cached by the appender instance
+    struct FilenameCache
+    {
+        bool initialized{false};
+        bool time_required{false};
+        bool utc_required{false};
+        bool local_required{false};
+        bool timezone_required{false};
+        uint64_t seconds{0};
+        char utc_datetime_str[19] = "1970-01-01T010101Z";
+        char utc_date_str[11] = "1970-01-01";
+        char utc_time_str[8] = "010101Z";
+        char utc_year_str[5] = "1970";
+        char utc_month_str[3] = "01";
+        char utc_day_str[3] = "01";
+        char utc_hour_str[3] = "00";
+        char utc_minute_str[3] = "00";
+        char utc_second_str[3] = "00";
+        char utc_timezone_str[2] = "Z";
+        char local_datetime_str[23] = "1970-01-01T010101+0000";
+        char local_date_str[11] = "1970-01-01";
+        char local_time_str[12] = "010101+0000";
+        char local_year_str[5] = "1970";
+        char local_month_str[3] = "01";
+        char local_day_str[3] = "01";
+        char local_hour_str[3] = "00";
+        char local_minute_str[3] = "00";
+        char local_second_str[3] = "00";
+        char local_timezone_str[6] = "+0000";
+    };
+
     TimeRollingPolicy _policy;
     std::string _pattern;
+    FilenameCache _cache;
     std::vector<Placeholder> _placeholders;
-    CppCommon::Timestamp _rollstamp{0};
-    CppCommon::Timespan _rolldelay{0};
+    bool _local{false};
+    uint64_t _rollstamp{0};
+    uint64_t _deadline{0};
     bool _first{true};
 
     bool FlushFile(uint64_t timestamp)
@@ -409,17 +1218,21 @@ private:
             // 1. Check if the file is already opened for writing
             if (_file.IsFileWriteOpened())
             {
-                // 1.1. Check the rolling timestamp
-                if (timestamp < (_rollstamp + _rolldelay))
+                // 1.1. Check the rolling deadline
+                if (timestamp < _deadline)
                     return true;
 
                 // 1.2. Flush & close the file
-                _file.Flush();
-                _file.Close();
+                CloseRolledFile(true);
 
-                // 1.3. Archive the file
+                // 1.3. Archive the file or describe it in the manifest
                 if (_archive)
                     ArchiveQueue(_file);
+                else
+                {
+                    AppendManifest(_file, RollingManifest::State::CLOSED, ManifestStats());
+                    RetainFile(_file);
+                }
             }
         }
         catch (const CppCommon::FileSystemException&)
@@ -443,24 +1256,10 @@ private:
             if ((CppCommon::Timestamp::utc() - _retry).milliseconds() < 100)
                 return false;
 
-            uint64_t rollstamp = timestamp;
-
-            // 3. Truncate rolling timestamp according to the time rolling policy
-            switch (_policy)
-            {
-                case TimeRollingPolicy::SECOND:
-                    rollstamp = (rollstamp / 1000000000ull) * 1000000000ull;
-                    break;
-                case TimeRollingPolicy::MINUTE:
-                    rollstamp = (rollstamp / (60 * 1000000000ull)) * (60 * 1000000000ull);
-                    break;
-                case TimeRollingPolicy::HOUR:
-                    rollstamp = (rollstamp / (60 * 60 * 1000000000ull)) * (60 * 60 * 1000000000ull);
-                    break;
-                default:
-                    rollstamp = (rollstamp / (24 * 60 * 60 * 1000000000ull)) * (24 * 60 * 60 * 1000000000ull);
-                    break;
-            }
+            // 3. Calculate the rolling period of the timestamp according to the time rolling policy
+            uint64_t rollstamp;
+            uint64_t deadline;
+            PrepareDeadline(timestamp, rollstamp, deadline);
 
             // 4. Reset the flag for the first rolling file
             if (_first)
@@ -473,22 +1272,33 @@ private:
                 _file.Close();
 
             // 6. Prepare the actual rolling file path
-            _file = PrepareFilePath(CppCommon::Timestamp(timestamp));
+            CppCommon::Path path = StreamPath(PrepareFilePath(CppCommon::Timestamp(timestamp)));
 
-            // 7. Create the parent directory tree
-            CppCommon::Directory::CreateTree(_file.parent());
-
-            // 8. Open or create the rolling file
-            _file.OpenOrCreate(false, true, _truncate);
+            // 7. Take the rolling file prepared in background or create the parent directory tree and open it
+            if (!TakePrepared(path))
+            {
+                _file = path;
+                CppCommon::Directory::CreateTree(_file.parent());
+                _file.OpenOrCreate(false, true, _truncate);
+            }
+            OpenStream();
+            OpenIndex();
+            OpenManifest();
+            OpenRetention();
 
-            // 9. Reset the written bytes counter
+            // 8. Reset the written bytes counter and start the new logging file generation
             _written = 0;
+            _generation = Record::NextGeneration();
 
-            // 10. Reset the retry timestamp
+            // 9. Reset the retry timestamp
             _retry = 0;
 
-            // 11. Reset the rolling timestamp
+            // 10. Reset the rolling timestamp and deadline
             _rollstamp = rollstamp;
+            _deadline = deadline;
+
+            // 11. Prepare the next rolling file in background
+            PrepareNext(StreamPath(PrepareFilePath(CppCommon::Timestamp(_deadline))));
 
             return true;
         }
@@ -500,142 +1310,228 @@ private:
         }
     }
 
+    void PrepareDeadline(uint64_t timestamp, uint64_t& rollstamp, uint64_t& deadline) const
+    {
+        const uint64_t second = 1000000000ull;
+
+        // Truncate the timestamp by fixed length periods
+        uint64_t period = 0;
+        switch (_policy)
+        {
+            case TimeRollingPolicy::SECOND:
+                period = second;
+                break;
+            case TimeRollingPolicy::MINUTE:
+                period = 60 * second;
+                break;
+            case TimeRollingPolicy::HOUR:
+                period = _local ? 0 : 60 * 60 * second;
+                break;
+            case TimeRollingPolicy::DAY:
+                period = _local ? 0 : 24 * 60 * 60 * second;
+                break;
+            default:
+                break;
+        }
+        if (period > 0)
+        {
+            rollstamp = (timestamp / period) * period;
+            deadline = rollstamp + period;
+            return;
+        }
+
+        // Calendar and local periods are converted from date & time, so daylight saving time is handled by timezone rules
+        CppCommon::Time time = _local ? (CppCommon::Time)CppCommon::LocalTime(CppCommon::Timestamp(timestamp)) : (CppCommon::Time)CppCommon::UtcTime(CppCommon::Timestamp(timestamp));
+        int year = time.year();
+        int month = time.month();
+        int day = time.day();
+        int hour = time.hour();
+        switch (_policy)
+        {
+            case TimeRollingPolicy::YEAR:
+                month = 1;
+                [[fallthrough]];
+            case TimeRollingPolicy::MONTH:
+                day = 1;
+                [[fallthrough]];
+            case TimeRollingPolicy::DAY:
+                hour = 0;
+                [[fallthrough]];
+            default:
+                break;
+        }
+
+        // Calculate the beginning of the next period
+        int next_year = year;
+        int next_month = month;
+        int next_day = day;
+        int next_hour = hour;
+        switch (_policy)
+        {
+            case TimeRollingPolicy::YEAR:
+                ++next_year;
+                break;
+            case TimeRollingPolicy::MONTH:
+                ++next_month;
+                break;
+            case TimeRollingPolicy::DAY:
+                ++next_day;
+                break;
+            default:
+                ++next_hour;
+                break;
+        }
+        if (next_hour > 23)
+        {
+            next_hour = 0;
+            ++next_day;
+        }
+        if (next_day > DaysInMonth(next_year, next_month))
+        {
+            next_day = 1;
+            ++next_month;
+        }
+        if (next_month > 12)
+        {
+            next_month = 1;
+            ++next_year;
+        }
+
+        // Ambiguous local time of the daylight saving time transition never moves the deadline before the timestamp
+        rollstamp = std::min(ConvertTimestamp(year, month, day, hour), timestamp);
+        deadline = std::max(ConvertTimestamp(next_year, next_month, next_day, next_hour), timestamp + second);
+    }
+
+    uint64_t ConvertTimestamp(int year, int month, int day, int hour) const
+    {
+        if (_local)
+            return CppCommon::LocalTime(year, month, day, hour).utcstamp().total();
+        else
+            return CppCommon::UtcTime(year, month, day, hour).utcstamp().total();
+    }
+
+    static int DaysInMonth(int year, int month)
+    {
+        static const int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        bool leap = ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0));
+        return ((month == 2) && leap) ? 29 : days[month - 1];
+    }
+
+    std::string RetentionPattern() const override
+    {
+        // Date & time placeholders are matched with digits and timezone characters
+        std::string result;
+        for (const auto& placeholder : _placeholders)
+        {
+            if (placeholder.type == PlaceholderType::String)
+                result += EscapePattern(placeholder.value);
+            else
+                result += "[0-9TZ+-]+";
+        }
+        return result;
+    }
+
     CppCommon::Path PrepareFilePath(const CppCommon::Timestamp& timestamp)
     {
-        thread_local bool cache_initizlied = false;
-        thread_local bool cache_time_required = false;
-        thread_local bool cache_utc_required = false;
-        thread_local bool cache_local_required = false;
-        thread_local bool cache_timezone_required = false;
-        thread_local uint64_t cache_seconds = 0;
-        thread_local char cache_utc_datetime_str[] = "1970-01-01T010101Z";
-        thread_local char cache_utc_date_str[] = "1970-01-01";
-        thread_local char cache_utc_time_str[] = "010101Z";
-        thread_local char cache_utc_year_str[] = "1970";
-        thread_local char cache_utc_month_str[] = "01";
-        thread_local char cache_utc_day_str[] = "01";
-        thread_local char cache_utc_hour_str[] = "00";
-        thread_local char cache_utc_minute_str[] = "00";
-        thread_local char cache_utc_second_str[] = "00";
-        thread_local char cache_utc_timezone_str[] = "Z";
-        thread_local char cache_local_datetime_str[] = "1970-01-01T010101+0000";
-        thread_local char cache_local_date_str[] = "1970-01-01";
-        thread_local char cache_local_time_str[] = "010101+0000";
-        thread_local char cache_local_year_str[] = "1970";
-        thread_local char cache_local_month_str[] = "01";
-        thread_local char cache_local_day_str[] = "01";
-        thread_local char cache_local_hour_str[] = "00";
-        thread_local char cache_local_minute_str[] = "00";
-        thread_local char cache_local_second_str[] = "00";
-        thread_local char cache_local_timezone_str[] = "+0000";
-        bool cache_update_datetime = false;
+        bool update_datetime = false;
 
         // Update time cache
-        if (cache_time_required || !cache_initizlied)
+        if (_cache.time_required || !_cache.initialized)
         {
             uint64_t seconds = timestamp.seconds();
 
-            if (seconds != cache_seconds)
+            if (seconds != _cache.seconds)
             {
-                cache_seconds = seconds;
+                _cache.seconds = seconds;
+
+                // Take date & time rendered once per second for the whole process
+                DateCache::Entry date;
+                DateCache::Get(seconds, date);
 
                 // Update timezone cache values
-                if (cache_timezone_required || !cache_initizlied)
+                if (_cache.timezone_required || !_cache.initialized)
                 {
-                    CppCommon::Timezone local;
-                    ConvertTimezone(cache_local_timezone_str, local.total().minutes(), 5);
-                    cache_update_datetime = true;
+                    ConvertTimezone(_cache.local_timezone_str, date.offset, 5);
+                    update_datetime = true;
                 }
 
                 // Update UTC time cache values
-                if (cache_utc_required || !cache_initizlied)
+                if (_cache.utc_required || !_cache.initialized)
                 {
-                    CppCommon::UtcTime utc(timestamp);
-                    ConvertNumber(cache_utc_year_str, utc.year(), 4);
-                    ConvertNumber(cache_utc_month_str, utc.month(), 2);
-                    ConvertNumber(cache_utc_day_str, utc.day(), 2);
-                    ConvertNumber(cache_utc_hour_str, utc.hour(), 2);
-                    ConvertNumber(cache_utc_minute_str, utc.minute(), 2);
-                    ConvertNumber(cache_utc_second_str, utc.second(), 2);
-                    cache_update_datetime = true;
+                    ConvertDate(_cache.utc_year_str, _cache.utc_month_str, _cache.utc_day_str, _cache.utc_hour_str, _cache.utc_minute_str, _cache.utc_second_str, date.utc);
+                    update_datetime = true;
                 }
 
                 // Update local time cache values
-                if (cache_local_required || !cache_initizlied)
+                if (_cache.local_required || !_cache.initialized)
                 {
-                    CppCommon::LocalTime local(timestamp);
-                    ConvertNumber(cache_local_year_str, local.year(), 4);
-                    ConvertNumber(cache_local_month_str, local.month(), 2);
-                    ConvertNumber(cache_local_day_str, local.day(), 2);
-                    ConvertNumber(cache_local_hour_str, local.hour(), 2);
-                    ConvertNumber(cache_local_minute_str, local.minute(), 2);
-                    ConvertNumber(cache_local_second_str, local.second(), 2);
-                    cache_update_datetime = true;
+                    ConvertDate(_cache.local_year_str, _cache.local_month_str, _cache.local_day_str, _cache.local_hour_str, _cache.local_minute_str, _cache.local_second_str, date.local);
+                    update_datetime = true;
                 }
             }
         }
 
         // Update date & time cache
-        if (cache_update_datetime)
+        if (update_datetime)
         {
-            char* buffer = cache_utc_date_str;
-            std::memcpy(buffer, cache_utc_year_str, CppCommon::countof(cache_utc_year_str) - 1);
-            buffer += CppCommon::countof(cache_utc_year_str) - 1;
+            char* buffer = _cache.utc_date_str;
+            std::memcpy(buffer, _cache.utc_year_str, CppCommon::countof(_cache.utc_year_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_year_str) - 1;
             *buffer++ = '-';
-            std::memcpy(buffer, cache_utc_month_str, CppCommon::countof(cache_utc_month_str) - 1);
-            buffer += CppCommon::countof(cache_utc_month_str) - 1;
+            std::memcpy(buffer, _cache.utc_month_str, CppCommon::countof(_cache.utc_month_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_month_str) - 1;
             *buffer++ = '-';
-            std::memcpy(buffer, cache_utc_day_str, CppCommon::countof(cache_utc_day_str) - 1);
-            buffer += CppCommon::countof(cache_utc_day_str) - 1;
-
-            buffer = cache_utc_time_str;
-            std::memcpy(buffer, cache_utc_hour_str, CppCommon::countof(cache_utc_hour_str) - 1);
-            buffer += CppCommon::countof(cache_utc_hour_str) - 1;
-            std::memcpy(buffer, cache_utc_minute_str, CppCommon::countof(cache_utc_minute_str) - 1);
-            buffer += CppCommon::countof(cache_utc_minute_str) - 1;
-            std::memcpy(buffer, cache_utc_second_str, CppCommon::countof(cache_utc_second_str) - 1);
-            buffer += CppCommon::countof(cache_utc_second_str) - 1;
-            std::memcpy(buffer, cache_utc_timezone_str, CppCommon::countof(cache_utc_timezone_str) - 1);
-            buffer += CppCommon::countof(cache_utc_timezone_str) - 1;
-
-            buffer = cache_utc_datetime_str;
-            std::memcpy(buffer, cache_utc_date_str, CppCommon::countof(cache_utc_date_str) - 1);
-            buffer += CppCommon::countof(cache_utc_date_str) - 1;
+            std::memcpy(buffer, _cache.utc_day_str, CppCommon::countof(_cache.utc_day_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_day_str) - 1;
+
+            buffer = _cache.utc_time_str;
+            std::memcpy(buffer, _cache.utc_hour_str, CppCommon::countof(_cache.utc_hour_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_hour_str) - 1;
+            std::memcpy(buffer, _cache.utc_minute_str, CppCommon::countof(_cache.utc_minute_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_minute_str) - 1;
+            std::memcpy(buffer, _cache.utc_second_str, CppCommon::countof(_cache.utc_second_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_second_str) - 1;
+            std::memcpy(buffer, _cache.utc_timezone_str, CppCommon::countof(_cache.utc_timezone_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_timezone_str) - 1;
+
+            buffer = _cache.utc_datetime_str;
+            std::memcpy(buffer, _cache.utc_date_str, CppCommon::countof(_cache.utc_date_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_date_str) - 1;
             *buffer++ = 'T';
-            std::memcpy(buffer, cache_utc_time_str, CppCommon::countof(cache_utc_time_str) - 1);
-            buffer += CppCommon::countof(cache_utc_time_str) - 1;
+            std::memcpy(buffer, _cache.utc_time_str, CppCommon::countof(_cache.utc_time_str) - 1);
+            buffer += CppCommon::countof(_cache.utc_time_str) - 1;
 
-            buffer = cache_local_date_str;
-            std::memcpy(buffer, cache_local_year_str, CppCommon::countof(cache_local_year_str) - 1);
-            buffer += CppCommon::countof(cache_local_year_str) - 1;
+            buffer = _cache.local_date_str;
+            std::memcpy(buffer, _cache.local_year_str, CppCommon::countof(_cache.local_year_str) - 1);
+            buffer += CppCommon::countof(_cache.local_year_str) - 1;
             *buffer++ = '-';
-            std::memcpy(buffer, cache_local_month_str, CppCommon::countof(cache_local_month_str) - 1);
-            buffer += CppCommon::countof(cache_local_month_str) - 1;
+            std::memcpy(buffer, _cache.local_month_str, CppCommon::countof(_cache.local_month_str) - 1);
+            buffer += CppCommon::countof(_cache.local_month_str) - 1;
             *buffer++ = '-';
-            std::memcpy(buffer, cache_local_day_str, CppCommon::countof(cache_local_day_str) - 1);
-            buffer += CppCommon::countof(cache_local_day_str) - 1;
-
-            buffer = cache_local_time_str;
-            std::memcpy(buffer, cache_local_hour_str, CppCommon::countof(cache_local_hour_str) - 1);
-            buffer += CppCommon::countof(cache_local_hour_str) - 1;
-            std::memcpy(buffer, cache_local_minute_str, CppCommon::countof(cache_local_minute_str) - 1);
-            buffer += CppCommon::countof(cache_local_minute_str) - 1;
-            std::memcpy(buffer, cache_local_second_str, CppCommon::countof(cache_local_second_str) - 1);
-            buffer += CppCommon::countof(cache_local_second_str) - 1;
-            std::memcpy(buffer, cache_local_timezone_str, CppCommon::countof(cache_local_timezone_str) - 1);
-            buffer += CppCommon::countof(cache_local_timezone_str) - 1;
-
-            buffer = cache_local_datetime_str;
-            std::memcpy(buffer, cache_local_date_str, CppCommon::countof(cache_local_date_str) - 1);
-            buffer += CppCommon::countof(cache_local_date_str) - 1;
+            std::memcpy(buffer, _cache.local_day_str, CppCommon::countof(_cache.local_day_str) - 1);
+            buffer += CppCommon::countof(_cache.local_day_str) - 1;
+
+            buffer = _cache.local_time_str;
+            std::memcpy(buffer, _cache.local_hour_str, CppCommon::countof(_cache.local_hour_str) - 1);
+            buffer += CppCommon::countof(_cache.local_hour_str) - 1;
+            std::memcpy(buffer, _cache.local_minute_str, CppCommon::countof(_cache.local_minute_str) - 1);
+            buffer += CppCommon::countof(_cache.local_minute_str) - 1;
+            std::memcpy(buffer, _cache.local_second_str, CppCommon::countof(_cache.local_second_str) - 1);
+            buffer += CppCommon::countof(_cache.local_second_str) - 1;
+            std::memcpy(buffer, _cache.local_timezone_str, CppCommon::countof(_cache.local_timezone_str) - 1);
+            buffer += CppCommon::countof(_cache.local_timezone_str) - 1;
+
+            buffer = _cache.local_datetime_str;
+            std::memcpy(buffer, _cache.local_date_str, CppCommon::countof(_cache.local_date_str) - 1);
+            buffer += CppCommon::countof(_cache.local_date_str) - 1;
             *buffer++ = 'T';
-            std::memcpy(buffer, cache_local_time_str, CppCommon::countof(cache_local_time_str) - 1);
-            buffer += CppCommon::countof(cache_local_time_str) - 1;
+            std::memcpy(buffer, _cache.local_time_str, CppCommon::countof(_cache.local_time_str) - 1);
+            buffer += CppCommon::countof(_cache.local_time_str) - 1;
 
-            cache_update_datetime = false;
+            update_datetime = false;
         }
 
-        cache_initizlied = true;
+        _cache.initialized = true;
 
         std::string filename;
 
@@ -653,180 +1549,180 @@ private:
                 case PlaceholderType::UtcDateTime:
                 {
                     // Output UTC date & time string
-                    filename.insert(filename.end(), std::begin(cache_utc_datetime_str), std::end(cache_utc_datetime_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_datetime_str), std::end(_cache.utc_datetime_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcDate:
                 {
                     // Output UTC date string
-                    filename.insert(filename.end(), std::begin(cache_utc_date_str), std::end(cache_utc_date_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_date_str), std::end(_cache.utc_date_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcTime:
                 {
                     // Output UTC time string
-                    filename.insert(filename.end(), std::begin(cache_utc_time_str), std::end(cache_utc_time_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_time_str), std::end(_cache.utc_time_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcYear:
                 {
                     // Output UTC year string
-                    filename.insert(filename.end(), std::begin(cache_utc_year_str), std::end(cache_utc_year_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_year_str), std::end(_cache.utc_year_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcMonth:
                 {
                     // Output UTC month string
-                    filename.insert(filename.end(), std::begin(cache_utc_month_str), std::end(cache_utc_month_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_month_str), std::end(_cache.utc_month_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcDay:
                 {
                     // Output UTC day string
-                    filename.insert(filename.end(), std::begin(cache_utc_day_str), std::end(cache_utc_day_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_day_str), std::end(_cache.utc_day_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcHour:
                 {
                     // Output UTC hour string
-                    filename.insert(filename.end(), std::begin(cache_utc_hour_str), std::end(cache_utc_hour_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_hour_str), std::end(_cache.utc_hour_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcMinute:
                 {
                     // Output UTC minute string
-                    filename.insert(filename.end(), std::begin(cache_utc_minute_str), std::end(cache_utc_minute_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_minute_str), std::end(_cache.utc_minute_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcSecond:
                 {
                     // Output UTC second string
-                    filename.insert(filename.end(), std::begin(cache_utc_second_str), std::end(cache_utc_second_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_second_str), std::end(_cache.utc_second_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_utc_required = true;
+                    _cache.time_required = true;
+                    _cache.utc_required = true;
                     break;
                 }
                 case PlaceholderType::UtcTimezone:
                 {
                     // Output UTC timezone string
-                    filename.insert(filename.end(), std::begin(cache_utc_timezone_str), std::end(cache_utc_timezone_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.utc_timezone_str), std::end(_cache.utc_timezone_str) - 1);
                     break;
                 }
                 case PlaceholderType::LocalDateTime:
                 {
                     // Output local date & time string
-                    filename.insert(filename.end(), std::begin(cache_local_datetime_str), std::end(cache_local_datetime_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_datetime_str), std::end(_cache.local_datetime_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
-                    cache_timezone_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
+                    _cache.timezone_required = true;
                     break;
                 }
                 case PlaceholderType::LocalDate:
                 {
                     // Output local date string
-                    filename.insert(filename.end(), std::begin(cache_local_date_str), std::end(cache_local_date_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_date_str), std::end(_cache.local_date_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
                     break;
                 }
                 case PlaceholderType::LocalTime:
                 {
                     // Output local time string
-                    filename.insert(filename.end(), std::begin(cache_local_time_str), std::end(cache_local_time_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_time_str), std::end(_cache.local_time_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
-                    cache_timezone_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
+                    _cache.timezone_required = true;
                     break;
                 }
                 case PlaceholderType::LocalYear:
                 {
                     // Output local year string
-                    filename.insert(filename.end(), std::begin(cache_local_year_str), std::end(cache_local_year_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_year_str), std::end(_cache.local_year_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
                     break;
                 }
                 case PlaceholderType::LocalMonth:
                 {
                     // Output local month string
-                    filename.insert(filename.end(), std::begin(cache_local_month_str), std::end(cache_local_month_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_month_str), std::end(_cache.local_month_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
                     break;
                 }
                 case PlaceholderType::LocalDay:
                 {
                     // Output local day string
-                    filename.insert(filename.end(), std::begin(cache_local_day_str), std::end(cache_local_day_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_day_str), std::end(_cache.local_day_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
                     break;
                 }
                 case PlaceholderType::LocalHour:
                 {
                     // Output local hour string
-                    filename.insert(filename.end(), std::begin(cache_local_hour_str), std::end(cache_local_hour_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_hour_str), std::end(_cache.local_hour_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
                     break;
                 }
                 case PlaceholderType::LocalMinute:
                 {
                     // Output local minute string
-                    filename.insert(filename.end(), std::begin(cache_local_minute_str), std::end(cache_local_minute_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_minute_str), std::end(_cache.local_minute_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
                     break;
                 }
                 case PlaceholderType::LocalSecond:
                 {
                     // Output local second string
-                    filename.insert(filename.end(), std::begin(cache_local_second_str), std::end(cache_local_second_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_second_str), std::end(_cache.local_second_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_local_required = true;
+                    _cache.time_required = true;
+                    _cache.local_required = true;
                     break;
                 }
                 case PlaceholderType::LocalTimezone:
                 {
                     // Output local timezone string
-                    filename.insert(filename.end(), std::begin(cache_local_timezone_str), std::end(cache_local_timezone_str) - 1);
+                    filename.insert(filename.end(), std::begin(_cache.local_timezone_str), std::end(_cache.local_timezone_str) - 1);
                     // Set the corresponding cache required flag
-                    cache_time_required = true;
-                    cache_timezone_required = true;
+                    _cache.time_required = true;
+                    _cache.timezone_required = true;
                     break;
                 }
             }
@@ -898,25 +1794,14 @@ private:
             AppendPattern("{" + placeholder + "}");
     }
 
-    static void ConvertNumber(char* output, int number, size_t size)
+    static void ConvertDate(char* year, char* month, char* day, char* hour, char* minute, char* second, const DateCache::DateTime& datetime)
     {
-        // Prepare the output string
-        std::memset(output, '0', size);
-
-        // Calculate the output index
-        size_t index = size - 1;
-
-        // Output digits
-        while ((number >= 10) && (index != 0))
-        {
-            int a = number / 10;
-            int b = number % 10;
-            output[index--] = '0' + (char)b;
-            number = a;
-        }
-
-        // Output the last digit
-        output[index] = '0' + (char)number;
+        std::memcpy(year, datetime.year, sizeof(datetime.year));
+        std::memcpy(month, datetime.month, sizeof(datetime.month));
+        std::memcpy(day, datetime.day, sizeof(datetime.day));
+        std::memcpy(hour, datetime.hour, sizeof(datetime.hour));
+        std::memcpy(minute, datetime.minute, sizeof(datetime.minute));
+        std::memcpy(second, datetime.second, sizeof(datetime.second));
     }
 
     static void ConvertTimezone(char* output, int64_t offset, size_t size)
@@ -962,9 +1847,11 @@ private:
 class SizePolicyImpl : public RollingFileAppender::Impl
 {
 public:
-    SizePolicyImpl(RollingFileAppender& appender, const CppCommon::Path& path, const std::string& filename, const std::string& extension, size_t size, size_t backups, bool archive, bool truncate, bool auto_flush, bool auto_start)
-        : RollingFileAppender::Impl(appender, path, archive, truncate, auto_flush, auto_start),
-          _filename(filename), _extension(extension), _size(size), _backups(backups)
+    static const size_t SEQUENCE_WIDTH = 6;
+
+    SizePolicyImpl(RollingFileAppender& appender, const CppCommon::Path& path, const std::string& filename, const std::string& extension, size_t size, size_t backups, bool archive, bool truncate, bool auto_flush, bool auto_start, const RollingOptions& options)
+        : RollingFileAppender::Impl(appender, path, archive, truncate, auto_flush, auto_start, SequenceOptions(options), options.sequence),
+          _filename(filename), _extension(extension), _size(size), _backups(backups), _sequential(options.sequence), _symlink(options.symlink)
     {
         assert((size > 0) && "Size limit should be greater than zero!");
         if (size <= 0)
@@ -982,6 +1869,16 @@ public:
             Stop();
     }
 
+    bool Stop() override
+    {
+        if (!Impl::Stop())
+            return false;
+
+        // Find the sequence number of the logging file to continue on the next start
+        _sequence = 0;
+        return true;
+    }
+
     void AppendRecord(Record& record) override
     {
         // Skip logging records without layout
@@ -992,15 +1889,21 @@ public:
 
         if (PrepareFile(size))
         {
+            RelayoutRecord(record, size);
+
             // Try to write logging record content into the opened file
             try
             {
-                _file.Write(record.raw.data(), size);
+                WriteStream(record.raw.data(), size);
                 _written += size;
 
+                // Update the logging records index and the manifest statistics
+                UpdateIndex(record, size);
+                UpdateManifest(record, size);
+
                 // Perform auto-flush if enabled
                 if (_auto_flush)
-                    _file.Flush();
+                    FlushStream();
             }
             catch (const CppCommon::FileSystemException&)
             {
@@ -1021,7 +1924,7 @@ public:
             // Try to flush the opened file
             try
             {
-                _file.Flush();
+                FlushStream();
             }
             catch (const CppCommon::FileSystemException&)
             {
@@ -1040,6 +1943,22 @@ private:
     std::string _extension;
     size_t _size;
     size_t _backups;
+    bool _sequential;
+    bool _symlink;
+    uint64_t _sequence{0};
+    uint64_t _removed{0};
+
+    static RollingOptions SequenceOptions(const RollingOptions& options)
+    {
+        // Pre-open and retention policy work only in the sequence naming mode
+        RollingOptions result = options;
+        if (!options.sequence)
+        {
+            result.preopen = false;
+            result.retention = RetentionPolicy();
+        }
+        return result;
+    }
 
     bool FlushFile(size_t size)
     {
@@ -1052,15 +1971,22 @@ private:
                 if ((_written + size) <= _size)
                     return true;
 
-                // 1.2. Flush & close the file
-                _file.Flush();
-                _file.Close();
+                // 1.2. Flush & close the file, backups are renamed only after the file is closed
+                CloseRolledFile(_sequential);
 
                 // 1.3. Archive or roll the current backup
-                if (_archive)
+                if (_sequential)
+                {
+                    // Archive and remove old logging files in the background and continue with the next sequence number
+                    if (!_archive)
+                        AppendManifest(_file, RollingManifest::State::CLOSED, ManifestStats());
+                    ArchiveQueue(_file);
+                    ++_sequence;
+                }
+                else if (_archive)
                     ArchiveQueue(_file);
                 else
-                    RollBackup(_file);
+                    AppendManifest(RollBackup(_file), RollingManifest::State::CLOSED, ManifestStats());
             }
         }
         catch (const CppCommon::FileSystemException&)
@@ -1088,21 +2014,37 @@ private:
             if (_file.IsFileReadOpened())
                 _file.Close();
 
-            // 4. Prepare the actual rolling file path
-            _file = PrepareFilePath();
+            // 4. Find the sequence number of the logging file to continue
+            if (_sequential && (_sequence == 0))
+                ScanSequence();
 
-            // 5. Create the parent directory tree
-            CppCommon::Directory::CreateTree(_file.parent());
+            // 5. Prepare the actual rolling file path
+            CppCommon::Path path = PrepareFilePath();
 
-            // 6. Open or create the rolling file
-            _file.OpenOrCreate(false, true, _truncate);
+            // 6. Take the rolling file prepared in background or create the parent directory tree and open it
+            if (!TakePrepared(path))
+            {
+                _file = path;
+                CppCommon::Directory::CreateTree(_file.parent());
+                _file.OpenOrCreate(false, true, _truncate);
+            }
+            OpenStream();
+            OpenIndex();
+            OpenManifest();
+            OpenRetention();
+            UpdateSymlink();
 
-            // 7. Reset the written bytes counter
+            // 7. Reset the written bytes counter and start the new logging file generation
             _written = 0;
+            _generation = Record::NextGeneration();
 
             // 8. Reset the retry timestamp
             _retry = 0;
 
+            // 9. Prepare the next sequence rolling file in background
+            if (_sequential)
+                PrepareNext(PrepareSequencePath(_sequence + 1));
+
             return true;
         }
         catch (const CppCommon::FileSystemException&)
@@ -1115,20 +2057,44 @@ private:
 
     void ArchiveQueue(const CppCommon::Path& path) override
     {
+        // Sequence file name is never reused, so the file is archived as is
+        if (_sequential)
+        {
+            Impl::ArchiveQueue(path);
+            return;
+        }
+
         // Create unique file name
         CppCommon::File unique = CppCommon::File(path).ReplaceFilename(CppCommon::File::unique());
         CppCommon::File::Rename(path, unique);
+        RenameIndex(path, unique);
+        RemoveManifest(path);
 
-        _archive_queue.Enqueue(unique);
+        _archive_queue.Enqueue(ArchiveItem{ unique, ManifestStats() });
     }
 
-    void ArchiveFile(const CppCommon::Path& path, const CppCommon::Path& filename) override
+    void ArchiveFile(const CppCommon::Path& path, const CppCommon::Path& filename, const RollingManifest::Entry& stats) override
     {
-        // Roll backup
+        if (_sequential)
+        {
+            // Archive the rolled file
+            if (_archive)
+                Impl::ArchiveFile(path, "", stats);
+            else
+                AppendRetention(path);
+
+            // Remove logging files and archives out of the backups count
+            uint64_t sequence = std::strtoull(CppCommon::Path(path).filename().string().c_str() + _filename.size() + 1, nullptr, 10);
+            while ((_removed + _backups) < sequence)
+                RemoveSequence(++_removed);
+            return;
+        }
+
+        // Roll backup, the retention policy is not applied to renamed backups
         CppCommon::File backup = RollBackup(path);
 
         // Archive backup
-        Impl::ArchiveFile(backup, PrepareFilePath());
+        Impl::ArchiveFile(backup, PrepareFilePath(), stats);
     }
 
     CppCommon::File RollBackup(const CppCommon::Path& path)
@@ -1137,9 +2103,12 @@ private:
         CppCommon::File backup = PrepareFilePath(_backups);
         if (backup.IsFileExists())
             CppCommon::File::Remove(backup);
+        RemoveIndex(backup);
+        RemoveManifest(backup);
         backup += "." + ARCHIVE_EXTENSION;
         if (backup.IsFileExists())
             CppCommon::File::Remove(backup);
+        RemoveManifest(backup);
 
         // Roll backup files
         for (size_t i = _backups - 1; i > 0; --i)
@@ -1148,51 +2117,153 @@ private:
             CppCommon::File dst = PrepareFilePath(i + 1);
             if (src.IsFileExists())
                 CppCommon::File::Rename(src, dst);
+            RenameIndex(src, dst);
+            RenameManifest(src, dst);
             src += "." + ARCHIVE_EXTENSION;
             dst += "." + ARCHIVE_EXTENSION;
             if (src.IsFileExists())
                 CppCommon::File::Rename(src, dst);
+            RenameManifest(src, dst);
         }
 
         // Backup the current file
         backup = PrepareFilePath(1);
         CppCommon::File::Rename(path, backup);
+        RenameIndex(path, backup);
+        RenameManifest(path, backup);
         return backup;
     }
 
+    void ScanSequence()
+    {
+        // Find the first and the last sequence numbers of existing logging files and archives
+        uint64_t first = 0;
+        uint64_t last = 0;
+        if (CppCommon::Directory(_path).IsDirectoryExists())
+        {
+            std::string prefix = _filename + ".";
+            std::string suffix = StreamPath(CppCommon::Path("." + _extension)).string();
+            std::string archive = suffix + "." + ARCHIVE_EXTENSION;
+            for (const auto& file : CppCommon::Directory(_path).GetFiles())
+            {
+                std::string name = file.filename().string();
+                if (name.compare(0, prefix.size(), prefix) != 0)
+                    continue;
+
+                size_t digits = prefix.size();
+                while ((digits < name.size()) && std::isdigit((unsigned char)name[digits]))
+                    ++digits;
+                if ((digits - prefix.size()) < SEQUENCE_WIDTH)
+                    continue;
+
+                std::string rest = name.substr(digits);
+                if ((rest != suffix) && (rest != archive))
+                    continue;
+
+                uint64_t sequence = std::strtoull(name.c_str() + prefix.size(), nullptr, 10);
+                first = (first == 0) ? sequence : std::min(first, sequence);
+                last = std::max(last, sequence);
+            }
+        }
+
+        // Continue the last logging file if it is not archived yet
+        if (last == 0)
+            _sequence = 1;
+        else if (CppCommon::File(PrepareSequencePath(last)).IsFileExists())
+            _sequence = last;
+        else
+            _sequence = last + 1;
+        _removed = (first > 0) ? (first - 1) : 0;
+    }
+
+    void RemoveSequence(uint64_t sequence)
+    {
+        try
+        {
+            CppCommon::File file = PrepareSequencePath(sequence);
+            if (file.IsFileExists())
+                CppCommon::File::Remove(file);
+            RemoveIndex(file);
+            RemoveManifest(file);
+            RemoveRetention(file);
+            file += "." + ARCHIVE_EXTENSION;
+            if (file.IsFileExists())
+                CppCommon::File::Remove(file);
+            RemoveManifest(file);
+            RemoveRetention(file);
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    void UpdateSymlink()
+    {
+        if (!_symlink)
+            return;
+
+        try
+        {
+            // Never replace the regular logging file with the same name
+            CppCommon::Path link = StreamPath(CppCommon::Path(_path / CppCommon::format("{}.{}", _filename, _extension)));
+            if (!link.IsSymlink() && link.IsExists())
+                return;
+
+            // Atomically replace the symlink to the current logging file
+            CppCommon::Path temp = CppCommon::Path(link).ReplaceFilename(CppCommon::File::unique());
+            CppCommon::Symlink::CreateSymlink(_file.filename(), temp);
+            CppCommon::Path::Rename(temp, link);
+        }
+        catch (const CppCommon::FileSystemException&) {}
+    }
+
+    std::string RetentionPattern() const override
+    {
+        // Current logging file, backups and sequence logging files
+        return EscapePattern(_filename) + "(\\.[0-9]+)?\\." + EscapePattern(_extension);
+    }
+
     CppCommon::Path PrepareFilePath()
     {
-        return CppCommon::Path(_path / CppCommon::format("{}.{}", _filename, _extension));
+        if (_sequential)
+            return PrepareSequencePath(_sequence);
+
+        return StreamPath(CppCommon::Path(_path / CppCommon::format("{}.{}", _filename, _extension)));
     }
 
     CppCommon::Path PrepareFilePath(size_t backup)
     {
-        return CppCommon::Path(_path / CppCommon::format("{}.{}.{}", _filename, backup, _extension));
+        return StreamPath(CppCommon::Path(_path / CppCommon::format("{}.{}.{}", _filename, backup, _extension)));
+    }
+
+    CppCommon::Path PrepareSequencePath(uint64_t sequence)
+    {
+        return StreamPath(CppCommon::Path(_path / CppCommon::format("{}.{:0{}}.{}", _filename, sequence, SEQUENCE_WIDTH, _extension)));
     }
 };
 
 //! @endcond
 
-RollingFileAppender::RollingFileAppender(const CppCommon::Path& path, TimeRollingPolicy policy, const std::string& pattern, bool archive, bool truncate, bool auto_flush, bool auto_start)
+RollingFileAppender::RollingFileAppender(const CppCommon::Path& path, TimeRollingPolicy policy, const std::string& pattern, bool archive, bool truncate, bool auto_flush, bool auto_start, const RollingOptions& options)
 {
     // Check implementation storage parameters
     [[maybe_unused]] CppCommon::ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
     static_assert((StorageSize >= sizeof(Impl)), "RollingFileAppender::StorageSize must be increased!");
     static_assert(((StorageAlign % alignof(Impl)) == 0), "RollingFileAppender::StorageAlign must be adjusted!");
+    static_assert((StorageSize >= sizeof(TimePolicyImpl)), "RollingFileAppender::StorageSize must be increased!");
 
     // Create the implementation instance
-    new(&_storage)TimePolicyImpl(*this, path, policy, pattern, archive, truncate, auto_flush, auto_start);
+    new(&_storage)TimePolicyImpl(*this, path, policy, pattern, archive, truncate, auto_flush, auto_start, options);
 }
 
-RollingFileAppender::RollingFileAppender(const CppCommon::Path& path, const std::string& filename, const std::string& extension, size_t size, size_t backups, bool archive, bool truncate, bool auto_flush, bool auto_start)
+RollingFileAppender::RollingFileAppender(const CppCommon::Path& path, const std::string& filename, const std::string& extension, size_t size, size_t backups, bool archive, bool truncate, bool auto_flush, bool auto_start, const RollingOptions& options)
 {
     // Check implementation storage parameters
     [[maybe_unused]] CppCommon::ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
     static_assert((StorageSize >= sizeof(Impl)), "RollingFileAppender::StorageSize must be increased!");
     static_assert(((StorageAlign % alignof(Impl)) == 0), "RollingFileAppender::StorageAlign must be adjusted!");
+    static_assert((StorageSize >= sizeof(SizePolicyImpl)), "RollingFileAppender::StorageSize must be increased!");
 
     // Create the implementation instance
-    new(&_storage)SizePolicyImpl(*this, path, filename, extension, size, backups, archive, truncate, auto_flush, auto_start);
+    new(&_storage)SizePolicyImpl(*this, path, filename, extension, size, backups, archive, truncate, auto_flush, auto_start, options);
 }
 
 RollingFileAppender::~RollingFileAppender()
@@ -1206,5 +2277,6 @@ bool RollingFileAppender::Start() { return impl().Start(); }
 bool RollingFileAppender::Stop() { return impl().Stop(); }
 void RollingFileAppender::AppendRecord(Record& record) { impl().AppendRecord(record); }
 void RollingFileAppender::Flush() { impl().Flush(); }
+RollingFileAppender::ArchiveStats RollingFileAppender::archive_stats() const { return impl().GetArchiveStats(); }
 
 } // namespace CppLogging
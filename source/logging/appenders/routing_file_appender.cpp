@@ -0,0 +1,391 @@
+/*!
+    \file routing_file_appender.cpp
+    \brief Routing file appender implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/appenders/routing_file_appender.h"
+
+#include "logging/date_cache.h"
+
+#include "errors/exceptions.h"
+
+#include <cassert>
+
+namespace CppLogging {
+
+RoutingFileAppender::RoutingFileAppender(const CppCommon::Path& path, const std::string& pattern, size_t max_files, size_t buffer_size, bool auto_flush, bool auto_start)
+    : _path(path), _max_files(max_files), _buffer_size(buffer_size), _auto_flush(auto_flush)
+{
+    assert((max_files > 0) && "Maximal number of opened files should be greater than zero!");
+    if (max_files == 0)
+        throwex CppCommon::ArgumentException("Maximal number of opened files should be greater than zero!");
+
+    std::string placeholder;
+    std::string subpattern;
+
+    // Tokenize routing pattern
+    bool read_placeholder = false;
+    for (char ch : pattern)
+    {
+        // Start reading placeholder or pattern
+        if (ch == '{')
+        {
+            if (read_placeholder)
+                AppendPattern(placeholder);
+            else
+                AppendPattern(subpattern);
+            placeholder.clear();
+            subpattern.clear();
+            read_placeholder = true;
+        }
+        // Stop reading placeholder or pattern
+        else if (ch == '}')
+        {
+            if (read_placeholder)
+            {
+                AppendPlaceholder(placeholder);
+                read_placeholder = false;
+            }
+            else
+                subpattern += ch;
+        }
+        // Continue reading placeholder or pattern
+        else
+        {
+            if (read_placeholder)
+                placeholder += ch;
+            else
+                subpattern += ch;
+        }
+    }
+
+    // Addend last value of placeholder or pattern
+    if (read_placeholder)
+        AppendPattern(placeholder);
+    else
+        AppendPattern(subpattern);
+
+    // File names are made again on the next second only if the pattern contains date placeholders
+    for (const auto& item : _placeholders)
+        if (item.type >= PlaceholderType::UtcDate)
+            _dated = true;
+
+    // Start the routing file appender
+    if (auto_start)
+        Start();
+}
+
+RoutingFileAppender::~RoutingFileAppender()
+{
+    // Stop the routing file appender
+    if (IsStarted())
+        Stop();
+}
+
+bool RoutingFileAppender::Start()
+{
+    if (IsStarted())
+        return false;
+
+    _started = true;
+    return true;
+}
+
+bool RoutingFileAppender::Stop()
+{
+    if (!IsStarted())
+        return false;
+
+    // Close all opened files
+    while (!_lru.empty())
+        CloseHandle(_lru.back());
+    _routes.clear();
+
+    _started = false;
+    return true;
+}
+
+void RoutingFileAppender::AppendRecord(Record& record)
+{
+    // Skip logging records without layout or if the appender is not started
+    if (record.raw.empty() || !IsStarted())
+        return;
+
+    // Find the route of the logger
+    auto it = _routes.find(record.logger);
+    if (it == _routes.end())
+        it = _routes.emplace(record.logger, Route()).first;
+    Route& route = it->second;
+
+    // Make the file name again only on the next second of the dated route
+    uint64_t seconds = record.timestamp / 1000000000ull;
+    if (route.filename.empty() || (_dated && (seconds != route.seconds)))
+    {
+        std::string filename = PrepareFilename(record.logger, seconds);
+        if (filename != route.filename)
+        {
+            route.filename = filename;
+            route.handle.reset();
+        }
+        route.seconds = seconds;
+    }
+
+    std::shared_ptr<Handle> handle = PrepareHandle(route);
+    if (!handle)
+        return;
+
+    // Lay out the logging record once again if it was laid out for another logging file
+    record.Relayout(handle->generation);
+
+    // Try to write logging record content into the opened file
+    try
+    {
+        size_t size = record.raw.size() - 1;
+        handle->file.Write(record.raw.data(), size);
+
+        // Perform auto-flush if enabled
+        if (_auto_flush)
+            handle->file.Flush();
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        // Try to close the opened file in case of any IO error
+        route.retry = CppCommon::Timestamp::utc();
+        CloseHandle(handle);
+    }
+}
+
+void RoutingFileAppender::Flush()
+{
+    // Try to flush all opened files
+    for (auto it = _lru.begin(); it != _lru.end();)
+    {
+        std::shared_ptr<Handle> handle = *it++;
+        try
+        {
+            handle->file.Flush();
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            // Try to close the opened file in case of any IO error
+            CloseHandle(handle);
+        }
+    }
+}
+
+void RoutingFileAppender::AppendPattern(const std::string& pattern)
+{
+    //  Skip empty pattern
+    if (pattern.empty())
+        return;
+
+    // Insert or append pattern into placeholders collection
+    if (_placeholders.empty() || (_placeholders[_placeholders.size() - 1].type != PlaceholderType::String))
+        _placeholders.emplace_back(PlaceholderType::String, pattern);
+    else
+        _placeholders[_placeholders.size() - 1].value += pattern;
+}
+
+void RoutingFileAppender::AppendPlaceholder(const std::string& placeholder)
+{
+    //  Skip empty placeholder
+    if (placeholder.empty())
+        return;
+
+    if (placeholder == "Logger")
+        _placeholders.emplace_back(PlaceholderType::Logger);
+    else if (placeholder == "UtcDate")
+        _placeholders.emplace_back(PlaceholderType::UtcDate);
+    else if (placeholder == "UtcYear")
+        _placeholders.emplace_back(PlaceholderType::UtcYear);
+    else if (placeholder == "UtcMonth")
+        _placeholders.emplace_back(PlaceholderType::UtcMonth);
+    else if (placeholder == "UtcDay")
+        _placeholders.emplace_back(PlaceholderType::UtcDay);
+    else if (placeholder == "UtcHour")
+        _placeholders.emplace_back(PlaceholderType::UtcHour);
+    else if (placeholder == "LocalDate")
+        _placeholders.emplace_back(PlaceholderType::LocalDate);
+    else if (placeholder == "LocalYear")
+        _placeholders.emplace_back(PlaceholderType::LocalYear);
+    else if (placeholder == "LocalMonth")
+        _placeholders.emplace_back(PlaceholderType::LocalMonth);
+    else if (placeholder == "LocalDay")
+        _placeholders.emplace_back(PlaceholderType::LocalDay);
+    else if (placeholder == "LocalHour")
+        _placeholders.emplace_back(PlaceholderType::LocalHour);
+    else
+        AppendPattern("{" + placeholder + "}");
+}
+
+std::string RoutingFileAppender::PrepareFilename(const std::string& logger, uint64_t seconds) const
+{
+    DateCache::Entry entry = {};
+    if (_dated)
+        DateCache::Get(seconds, entry);
+
+    std::string filename;
+
+    // Iterate through all placeholders
+    for (const auto& placeholder : _placeholders)
+    {
+        const DateCache::DateTime& datetime = (placeholder.type >= PlaceholderType::LocalDate) ? entry.local : entry.utc;
+        switch (placeholder.type)
+        {
+            case PlaceholderType::String:
+            {
+                // Output pattern string
+                filename.append(placeholder.value);
+                break;
+            }
+            case PlaceholderType::Logger:
+            {
+                // Output logger name with characters allowed in file names, so it never leaves the logging path
+                if (logger.empty())
+                    filename.append("default");
+                else if ((logger == ".") || (logger == ".."))
+                    filename.append(logger.size(), '_');
+                else
+                {
+                    for (char ch : logger)
+                    {
+                        switch (ch)
+                        {
+                            case '/':
+                            case '\\':
+                            case ':':
+                            case '*':
+                            case '?':
+                            case '"':
+                            case '<':
+                            case '>':
+                            case '|':
+                                filename.push_back('_');
+                                break;
+                            default:
+                                filename.push_back(((unsigned char)ch < 0x20) ? '_' : ch);
+                                break;
+                        }
+                    }
+                }
+                break;
+            }
+            case PlaceholderType::UtcDate:
+            case PlaceholderType::LocalDate:
+            {
+                // Output date string
+                filename.append(datetime.year, sizeof(datetime.year));
+                filename.push_back('-');
+                filename.append(datetime.month, sizeof(datetime.month));
+                filename.push_back('-');
+                filename.append(datetime.day, sizeof(datetime.day));
+                break;
+            }
+            case PlaceholderType::UtcYear:
+            case PlaceholderType::LocalYear:
+            {
+                // Output year string
+                filename.append(datetime.year, sizeof(datetime.year));
+                break;
+            }
+            case PlaceholderType::UtcMonth:
+            case PlaceholderType::LocalMonth:
+            {
+                // Output month string
+                filename.append(datetime.month, sizeof(datetime.month));
+                break;
+            }
+            case PlaceholderType::UtcDay:
+            case PlaceholderType::LocalDay:
+            {
+                // Output day string
+                filename.append(datetime.day, sizeof(datetime.day));
+                break;
+            }
+            case PlaceholderType::UtcHour:
+            case PlaceholderType::LocalHour:
+            {
+                // Output hour string
+                filename.append(datetime.hour, sizeof(datetime.hour));
+                break;
+            }
+        }
+    }
+
+    return filename;
+}
+
+std::shared_ptr<RoutingFileAppender::Handle> RoutingFileAppender::PrepareHandle(Route& route)
+{
+    // 1. Check if the route file is already opened
+    if (route.handle && !route.handle->closed)
+    {
+        _lru.splice(_lru.begin(), _lru, route.handle->lru);
+        return route.handle;
+    }
+
+    // 2. Take the file opened by another route
+    auto it = _files.find(route.filename);
+    if (it != _files.end())
+    {
+        route.handle = it->second;
+        _lru.splice(_lru.begin(), _lru, route.handle->lru);
+        return route.handle;
+    }
+
+    // 3. Check retry timestamp if 100ms elapsed after the last attempt
+    route.handle.reset();
+    if ((CppCommon::Timestamp::utc() - route.retry).milliseconds() < 100)
+        return nullptr;
+
+    try
+    {
+        // 4. Close the least recently used files over the limit
+        while (_files.size() >= _max_files)
+            CloseHandle(_lru.back());
+
+        // 5. Open the file for writing
+        auto handle = std::make_shared<Handle>(route.filename, _path / route.filename);
+        CppCommon::Directory::CreateTree(handle->file.parent());
+        handle->file.OpenOrCreate(false, true, false, CppCommon::File::DEFAULT_ATTRIBUTES, CppCommon::File::DEFAULT_PERMISSIONS, _buffer_size);
+
+        // 6. Insert the file into the LRU cache
+        _lru.push_front(handle);
+        handle->lru = _lru.begin();
+        _files.emplace(route.filename, handle);
+
+        // 7. Reset the the retry timestamp
+        route.retry = 0;
+        route.handle = handle;
+
+        return handle;
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        // In case of any IO error reset the retry timestamp and return nullptr!
+        route.retry = CppCommon::Timestamp::utc();
+        return nullptr;
+    }
+}
+
+void RoutingFileAppender::CloseHandle(const std::shared_ptr<Handle>& handle)
+{
+    // Keep the handle alive while it is removed from the LRU cache
+    std::shared_ptr<Handle> instance = handle;
+
+    try
+    {
+        if (instance->file)
+            instance->file.Close();
+    }
+    catch (const CppCommon::FileSystemException&) {}
+
+    instance->closed = true;
+    _files.erase(instance->filename);
+    _lru.erase(instance->lru);
+}
+
+} // namespace CppLogging
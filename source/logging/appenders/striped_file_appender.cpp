@@ -0,0 +1,374 @@
+/*!
+    \file striped_file_appender.cpp
+    \brief Striped file appender implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/appenders/striped_file_appender.h"
+
+#include "errors/exceptions.h"
+#include "threads/thread.h"
+#include "threads/wait_queue.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <thread>
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+struct StripedFileAppender::Stripe
+{
+    CppCommon::File file;
+    CppCommon::Timestamp retry{0};
+    uint16_t index;
+    uint16_t count;
+    bool truncate;
+
+    // Logging file generation, updated by the writer thread when it opens the stripe file
+    std::atomic<uint64_t> generation{Record::NextGeneration()};
+
+    // Pending batch of the logging thread
+    std::vector<uint8_t> batch;
+    size_t records{0};
+
+    // Batches queue of the writer thread, empty batch requests to flush the file
+    std::unique_ptr<CppCommon::WaitQueue<std::vector<uint8_t>>> queue;
+    std::thread thread;
+
+    Stripe(const CppCommon::Path& path, size_t stripe, size_t stripes, bool truncate_file)
+        : file(path), index((uint16_t)stripe), count((uint16_t)stripes), truncate(truncate_file)
+    {
+    }
+
+    //! Prepare the stripe file for writing
+    /*
+        - If the file is opened and ready to write immediately returns true
+        - If the last retry was earlier than 100ms immediately returns false
+        - If the file is closed try to open it for writing, restore its sequence numbers and truncate its torn tail, returns true/false
+        - If the existing file is not the stripe file of the same stripe it is renamed aside instead of being truncated
+
+        \param sequence - Next sequence number to update with restored sequence numbers (default is nullptr)
+        \return 'true' if the file was successfully prepared, 'false' if the file failed to be prepared
+    */
+    bool PrepareFile(uint64_t* sequence = nullptr)
+    {
+        try
+        {
+            // 1. Check if the file is already opened for writing
+            if (file.IsFileWriteOpened())
+                return true;
+
+            // 2. Check retry timestamp if 100ms elapsed after the last attempt
+            if ((CppCommon::Timestamp::utc() - retry).milliseconds() < 100)
+                return false;
+
+            // 3. If the file is opened for reading close it
+            if (file.IsFileReadOpened())
+                file.Close();
+
+            // 4. Restore sequence numbers of the existing stripe file
+            uint64_t offset = 0;
+            uint64_t size = 0;
+            if (!truncate && file.IsFileExists())
+            {
+                CppCommon::File input(file);
+                input.Open(true, false);
+                size = input.size();
+                offset = Restore(input, sequence);
+                input.Close();
+            }
+
+            // 5. Rename aside the existing file which is not the stripe file of the same stripe
+            if ((offset == 0) && (size > 0))
+                CppCommon::File::Rename(file, file.string() + "." + std::to_string(CppCommon::Timestamp::utc()) + ".bak");
+
+            // 6. Open the file for writing
+            file.OpenOrCreate(false, true, (offset == 0));
+
+            if (offset == 0)
+            {
+                // 7. Write the stripe file header into the new file
+                uint8_t header[FILE_HEADER_SIZE] = {};
+                std::memcpy(header, FILE_MAGIC, sizeof(FILE_MAGIC));
+                header[4] = VERSION;
+                std::memcpy(header + 6, &index, sizeof(uint16_t));
+                std::memcpy(header + 8, &count, sizeof(uint16_t));
+                file.Write(header, sizeof(header));
+            }
+            else
+            {
+                // 7. Truncate the torn tail and continue to append frames
+                file.Resize(offset);
+                file.Seek(offset);
+            }
+
+            // 8. Start the new logging file generation
+            generation.store(Record::NextGeneration(), std::memory_order_relaxed);
+
+            // 9. Reset the the retry timestamp
+            retry = 0;
+
+            return true;
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            // In case of any IO error reset the retry timestamp and return false!
+            retry = CppCommon::Timestamp::utc();
+            return false;
+        }
+    }
+
+    //! Close the stripe file
+    /*
+        \return 'true' if the file was successfully closed, 'false' if the file failed to close
+    */
+    bool CloseFile()
+    {
+        try
+        {
+            if (file)
+                file.Close();
+            return true;
+        }
+        catch (const CppCommon::FileSystemException&) { return false; }
+    }
+
+    //! Scan frames of the existing stripe file
+    /*
+        \param input - Stripe file opened for reading
+        \param sequence - Next sequence number to update with restored sequence numbers
+        \return End offset of the last valid frame, 0 if the file is not the stripe file of the same stripe
+    */
+    uint64_t Restore(CppCommon::File& input, uint64_t* sequence)
+    {
+        uint64_t size = input.size();
+        if (size < FILE_HEADER_SIZE)
+            return 0;
+
+        // Validate the stripe file header
+        uint8_t header[FILE_HEADER_SIZE];
+        uint16_t header_index, header_count;
+        if ((input.Read(header, sizeof(header)) != sizeof(header)) || !ParseFileHeader(header, header_index, header_count) || (header_index != index) || (header_count != count))
+            return 0;
+
+        // Scan frame headers with the buffered sequential read
+        std::vector<uint8_t> buffer(65536);
+        size_t begin = 0;
+        size_t end = 0;
+        uint64_t offset = FILE_HEADER_SIZE;
+        uint64_t position = FILE_HEADER_SIZE;
+        for (;;)
+        {
+            // Read more data if the frame header is not buffered
+            if ((end - begin) < FRAME_HEADER_SIZE)
+            {
+                std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+                end -= begin;
+                begin = 0;
+                size_t result = input.Read(buffer.data() + end, buffer.size() - end);
+                if (result == 0)
+                    break;
+                end += result;
+                position += result;
+                continue;
+            }
+
+            uint64_t frame_sequence;
+            uint32_t frame_size;
+            std::memcpy(&frame_sequence, buffer.data() + begin, sizeof(uint64_t));
+            std::memcpy(&frame_size, buffer.data() + begin + sizeof(uint64_t), sizeof(uint32_t));
+            if ((offset + FRAME_HEADER_SIZE + frame_size) > size)
+                break;
+
+            // Skip the frame content
+            uint64_t next = offset + FRAME_HEADER_SIZE + frame_size;
+            if (next <= position)
+                begin = (size_t)(end - (position - next));
+            else
+            {
+                input.Seek(next);
+                position = next;
+                begin = end = 0;
+            }
+            offset = next;
+
+            if (sequence != nullptr)
+                *sequence = std::max(*sequence, frame_sequence + 1);
+        }
+
+        return offset;
+    }
+
+    void WriterThread()
+    {
+        std::vector<uint8_t> item;
+        while (queue->Dequeue(item))
+        {
+            // Batches are lost until the stripe file is recovered
+            if (!PrepareFile())
+                continue;
+
+            // Try to write the batch or flush the opened file
+            try
+            {
+                if (item.empty())
+                    file.Flush();
+                else
+                    file.Write(item.data(), item.size());
+            }
+            catch (const CppCommon::FileSystemException&)
+            {
+                // Try to close the opened file in case of any IO error
+                CloseFile();
+            }
+        }
+    }
+};
+
+//! @endcond
+
+StripedFileAppender::StripedFileAppender(const std::vector<CppCommon::Path>& directories, const CppCommon::Path& filename, StripingMode mode, size_t batch_size, bool truncate, bool auto_start)
+    : _mode(mode), _batch_size(batch_size), _truncate(truncate)
+{
+    assert((!directories.empty() && (directories.size() <= std::numeric_limits<uint16_t>::max())) && "Stripes count should be in range from 1 to 65535!");
+    if (directories.empty() || (directories.size() > std::numeric_limits<uint16_t>::max()))
+        throwex CppCommon::ArgumentException("Stripes count should be in range from 1 to 65535!");
+
+    assert((batch_size > 0) && "Batch size should be greater than zero!");
+    if (batch_size == 0)
+        throwex CppCommon::ArgumentException("Batch size should be greater than zero!");
+
+    for (size_t i = 0; i < directories.size(); ++i)
+        _stripes.emplace_back(std::make_unique<Stripe>(directories[i] / filename, i, directories.size(), truncate));
+
+    // Start the striped file appender
+    if (auto_start)
+        Start();
+}
+
+StripedFileAppender::~StripedFileAppender()
+{
+    // Stop the striped file appender
+    if (IsStarted())
+        Stop();
+}
+
+bool StripedFileAppender::Start()
+{
+    if (IsStarted())
+        return false;
+
+    // Continue sequence numbers of existing stripe files
+    uint64_t sequence = _truncate ? 0 : _sequence;
+    for (auto& stripe : _stripes)
+    {
+        CppCommon::Directory::CreateTree(stripe->file.parent());
+        stripe->PrepareFile(&sequence);
+    }
+    _sequence = sequence;
+    _current = 0;
+
+    // Start writer threads
+    for (auto& stripe : _stripes)
+    {
+        Stripe* instance = stripe.get();
+        instance->queue = std::make_unique<CppCommon::WaitQueue<std::vector<uint8_t>>>();
+        instance->thread = CppCommon::Thread::Start([instance]() { instance->WriterThread(); });
+    }
+
+    _started = true;
+    return true;
+}
+
+bool StripedFileAppender::Stop()
+{
+    if (!IsStarted())
+        return false;
+
+    // Write pending batches and stop writer threads
+    for (auto& stripe : _stripes)
+    {
+        SendBatch(*stripe);
+        stripe->queue->Close();
+        stripe->thread.join();
+        stripe->queue.reset();
+        stripe->CloseFile();
+    }
+
+    _started = false;
+    return true;
+}
+
+void StripedFileAppender::AppendRecord(Record& record)
+{
+    // Skip logging records without layout or if the appender is not started
+    if (record.raw.empty() || !IsStarted())
+        return;
+
+    Stripe& stripe = (_mode == StripingMode::LOGGER) ? *_stripes[std::hash<std::string>()(record.logger) % _stripes.size()] : *_stripes[_current];
+
+    // Lay out the logging record once again if it was laid out for another stripe file
+    record.Relayout(stripe.generation.load(std::memory_order_relaxed));
+
+    // Append the frame of the logging record into the pending batch
+    uint32_t size = (uint32_t)(record.raw.size() - 1);
+    uint8_t header[FRAME_HEADER_SIZE];
+    std::memcpy(header, &_sequence, sizeof(uint64_t));
+    std::memcpy(header + sizeof(uint64_t), &size, sizeof(uint32_t));
+    stripe.batch.insert(stripe.batch.end(), header, header + sizeof(header));
+    stripe.batch.insert(stripe.batch.end(), record.raw.data(), record.raw.data() + size);
+    ++_sequence;
+
+    if (++stripe.records >= _batch_size)
+    {
+        SendBatch(stripe);
+
+        // Switch to the next stripe after the full batch
+        if (_mode == StripingMode::ROUND_ROBIN)
+            _current = (_current + 1) % _stripes.size();
+    }
+}
+
+void StripedFileAppender::Flush()
+{
+    if (!IsStarted())
+        return;
+
+    // Write pending batches and flush stripe files
+    for (auto& stripe : _stripes)
+    {
+        SendBatch(*stripe);
+        stripe->queue->Enqueue(std::vector<uint8_t>());
+    }
+}
+
+bool StripedFileAppender::ParseFileHeader(const uint8_t* buffer, uint16_t& index, uint16_t& count)
+{
+    if ((std::memcmp(buffer, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) || (buffer[4] != VERSION))
+        return false;
+
+    std::memcpy(&index, buffer + 6, sizeof(uint16_t));
+    std::memcpy(&count, buffer + 8, sizeof(uint16_t));
+    return (index < count);
+}
+
+void StripedFileAppender::SendBatch(Stripe& stripe)
+{
+    if (stripe.records == 0)
+        return;
+
+    stripe.queue->Enqueue(std::move(stripe.batch));
+    stripe.batch.clear();
+    stripe.batch.reserve(_batch_size * 128);
+    stripe.records = 0;
+}
+
+} // namespace CppLogging
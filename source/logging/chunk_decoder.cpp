@@ -0,0 +1,116 @@
+/*!
+    \file chunk_decoder.cpp
+    \brief Parallel chunk decoder implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/chunk_decoder.h"
+
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace CppLogging {
+
+bool ChunkDecoder::Decode(const std::vector<Chunk>& chunks, CppCommon::Writer& output, size_t threads, const Decoder& decoder)
+{
+    threads = std::max(threads, (size_t)1);
+
+    // Keep formatted text of the limited number of chunks to bound memory use
+    const size_t window = 2 * threads;
+    std::vector<std::string> texts(window);
+    std::vector<bool> ready(chunks.size(), false);
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t next = 0;
+    size_t written = 0;
+    bool stop = false;
+    bool failed = false;
+
+    // Decode and format chunks in worker threads with one text layout per thread
+    auto worker = [&]()
+    {
+        TextLayout layout;
+        Record record;
+        std::string text;
+        for (;;)
+        {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() { return stop || (next == chunks.size()) || (next < (written + window)); });
+                if (stop || (next == chunks.size()))
+                    return;
+                index = next++;
+            }
+
+            try
+            {
+                text.clear();
+                decoder(chunks[index], layout, record, text);
+            }
+            catch (...)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                error = std::current_exception();
+                stop = true;
+                cv.notify_all();
+                return;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                std::swap(texts[index % window], text);
+                ready[index] = true;
+            }
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::min(threads, chunks.size()); ++i)
+        workers.emplace_back(CppCommon::Thread::Start(worker));
+
+    // Write formatted chunks in order
+    std::string text;
+    for (size_t index = 0; index < chunks.size(); ++index)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&]() { return stop || ready[index]; });
+            if (stop)
+                break;
+            text.clear();
+            std::swap(text, texts[index % window]);
+        }
+
+        failed = (output.Write(text.data(), text.size()) != text.size());
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            written = index + 1;
+            stop = failed;
+        }
+        cv.notify_all();
+
+        if (failed)
+            break;
+    }
+
+    for (auto& thread : workers)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+
+    return !failed;
+}
+
+} // namespace CppLogging
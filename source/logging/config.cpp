@@ -8,12 +8,148 @@
 
 #include "logging/config.h"
 
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace CppLogging {
 
+//! @cond INTERNALS
+
+struct Config::Registry
+{
+    uint64_t epoch{0};
+    std::unordered_map<std::string, std::shared_ptr<Processor>> sinks;
+
+    const std::shared_ptr<Processor>* Find(const std::string& name) const
+    {
+        auto it = sinks.find(name);
+        return (it != sinks.end()) ? &it->second : nullptr;
+    }
+
+    const std::shared_ptr<Processor>* Resolve(const std::string& name) const
+    {
+        // Resolve the logger name hierarchy from the most specific to the top level one
+        std::string current(name);
+        while (!current.empty())
+        {
+            const std::shared_ptr<Processor>* sink = Find(current);
+            if (sink != nullptr)
+                return sink;
+
+            size_t separator = current.rfind('.');
+            if (separator == std::string::npos)
+                break;
+
+            current.resize(separator);
+        }
+
+        return nullptr;
+    }
+};
+
+struct Config::Retired
+{
+    uint64_t epoch;
+    uint64_t timestamp;
+    std::unique_ptr<const Registry> registry;
+};
+
+struct Config::ProducerExit
+{
+    ~ProducerExit() { Config::Unregister(Internals::Producer::Current()); }
+};
+
+namespace Internals {
+
+std::atomic<uint64_t> ConfigEpoch{1};
+
+uint64_t Producer::Announce(uint64_t epoch)
+{
+    // Producer threads are not tracked after their exit
+    if (_exited)
+        return epoch;
+
+    if (!_registered)
+    {
+        // Register the producer thread and announce the fresh configuration epoch,
+        // so registry snapshots released before the registration are never used
+        Config::Register(*this);
+        epoch = ConfigEpoch.load(std::memory_order_acquire);
+    }
+
+    _epoch.store(epoch, std::memory_order_release);
+    return epoch;
+}
+
+} // namespace Internals
+
+namespace {
+
+//! Collect the logging processor with its layout, filters, appenders and sub processors
+void Reach(Processor& processor, std::unordered_set<const Element*>& reachable)
+{
+    if (!reachable.insert(&processor).second)
+        return;
+
+    if (processor.layout())
+        reachable.insert(processor.layout().get());
+    for (auto& filter : processor.filters())
+        reachable.insert(filter.get());
+    for (auto& appender : processor.appenders())
+        reachable.insert(appender.get());
+    for (auto& sub : processor.processors())
+        if (sub)
+            Reach(*sub, reachable);
+}
+
+//! Detach reachable layout, filters, appenders and sub processors from the retired logging processor
+void Detach(Processor& processor, const std::unordered_set<const Element*>& reachable)
+{
+    auto used = [&reachable](const auto& element) { return reachable.find(element.get()) != reachable.end(); };
+
+    if (processor.layout() && used(processor.layout()))
+        processor.layout().reset();
+
+    auto& filters = processor.filters();
+    filters.erase(std::remove_if(filters.begin(), filters.end(), used), filters.end());
+    auto& appenders = processor.appenders();
+    appenders.erase(std::remove_if(appenders.begin(), appenders.end(), used), appenders.end());
+    auto& processors = processor.processors();
+    processors.erase(std::remove_if(processors.begin(), processors.end(), used), processors.end());
+
+    // Detach sub processors which will be released together with the retired logging processor
+    for (auto& sub : processors)
+        if (sub && (sub.use_count() == 1))
+            Detach(*sub, reachable);
+}
+
+} // namespace
+
+//! @endcond
+
+const CppCommon::Timespan Config::RETIRE_DELAY = CppCommon::Timespan::seconds(1);
+
+Config::Config() = default;
+
 Config::~Config()
 {
     // Shutdown working logger processors
     Shutdown();
+
+    // Stop the retire thread
+    if (_retire_thread.joinable())
+    {
+        _retire_stop = true;
+        _retire_queue.Enqueue(0);
+        _retire_thread.join();
+    }
+
+    // Release all retired registry snapshots together with the configuration
+    Release(true);
 }
 
 void Config::ConfigLogger(const std::shared_ptr<Processor>& sink)
@@ -38,31 +174,84 @@ Logger Config::CreateLogger()
 {
     Config& instance = GetInstance();
 
+    // Enter the producer scope, so the registry snapshot is not released during the lookup
+    Internals::Producer::Scope scope;
+
+    // Lookup of the default logger in the current registry snapshot
+    const Registry* registry = instance._registry.load(std::memory_order_acquire);
+    if (registry)
+    {
+        const std::shared_ptr<Processor>* sink = registry->Find("");
+        if (sink != nullptr)
+            return Logger("", sink->get(), registry->epoch);
+    }
+
     CppCommon::Locker<CppCommon::CriticalSection> locker(instance._lock);
 
-    auto it = instance._working.find("");
-    if (it != instance._working.end())
-        return Logger(it->first, it->second);
-    else
+    // Check the default logger once again under the lock
+    registry = instance._registry.load(std::memory_order_acquire);
+    if (registry)
     {
-        auto sink = std::make_shared<Processor>(std::make_shared<TextLayout>());
-        sink->appenders().push_back(std::make_shared<ConsoleAppender>());
-        instance._working[""] = sink;
-        return Logger("", sink);
+        const std::shared_ptr<Processor>* sink = registry->Find("");
+        if (sink != nullptr)
+            return Logger("", sink->get(), registry->epoch);
     }
+
+    // Publish the new registry snapshot with the default logger
+    auto sink = std::make_shared<Processor>(std::make_shared<TextLayout>());
+    sink->appenders().push_back(std::make_shared<ConsoleAppender>());
+    auto updated = registry ? std::make_unique<Registry>(*registry) : std::make_unique<Registry>();
+    updated->sinks[""] = sink;
+    instance.Publish(std::move(updated));
+    return Logger("", sink.get(), Internals::ConfigEpoch.load(std::memory_order_relaxed));
 }
 
 Logger Config::CreateLogger(const std::string& name)
 {
     Config& instance = GetInstance();
 
-    CppCommon::Locker<CppCommon::CriticalSection> locker(instance._lock);
+    // Enter the producer scope, so the registry snapshot is not released during the lookup
+    Internals::Producer::Scope scope;
+
+    // Hierarchical lookup of the named logger in the current registry snapshot
+    const Registry* registry = instance._registry.load(std::memory_order_acquire);
+    if (registry)
+    {
+        const std::shared_ptr<Processor>* sink = registry->Resolve(name);
+        if (sink != nullptr)
+            return Logger(name, sink->get(), registry->epoch);
+    }
+
+    return CreateLogger();
+}
+
+Processor* Config::ResolveSink(const std::string& name, uint64_t& epoch)
+{
+    Config& instance = GetInstance();
 
-    auto it = instance._working.find(name);
-    if (it != instance._working.end())
-        return Logger(it->first, it->second);
-    else
-        return CreateLogger();
+    // Enter the producer scope, so the registry snapshot is not released during the lookup
+    Internals::Producer::Scope scope;
+
+    // Read the epoch before the registry snapshot, so the stale pair will be refreshed once again
+    epoch = scope.epoch();
+    const Registry* registry = instance._registry.load(std::memory_order_acquire);
+    if (!registry)
+        return nullptr;
+
+    // Hierarchical lookup with a fallback to the default logger
+    const std::shared_ptr<Processor>* sink = registry->Resolve(name);
+    if (sink == nullptr)
+        sink = registry->Find("");
+    if (sink != nullptr)
+    {
+        epoch = registry->epoch;
+        return sink->get();
+    }
+
+    // Create the default logger
+    Logger logger = CreateLogger();
+    epoch = logger._epoch.load(std::memory_order_relaxed);
+    return logger._sink.load(std::memory_order_relaxed);
 }
 
 void Config::Startup()
@@ -71,14 +260,19 @@ void Config::Startup()
 
     CppCommon::Locker<CppCommon::CriticalSection> locker(instance._lock);
 
-    // Update working logger processors map
-    std::swap(instance._working, instance._config);
+    // Prepare the new registry snapshot of working logger processors
+    auto registry = std::make_unique<Registry>();
+    for (auto& processor : instance._config)
+        registry->sinks[processor.first] = processor.second;
 
     // Start all working logger processors
-    for (auto& processor : instance._working)
+    for (auto& processor : registry->sinks)
         if (processor.second)
             processor.second->Start();
 
+    // Publish the new registry snapshot and retire the previous one in the background
+    instance.Publish(std::move(registry));
+
     // Clear config logger processors map
     instance._config.clear();
 }
@@ -89,18 +283,179 @@ void Config::Shutdown()
 
     CppCommon::Locker<CppCommon::CriticalSection> locker(instance._lock);
 
-    // Flush and stop all working logger processors
-    for (auto& processor : instance._working)
+    const Registry* registry = instance._registry.load(std::memory_order_acquire);
+    if (registry)
     {
-        if (processor.second)
+        // Flush and stop all working logger processors
+        for (auto& processor : registry->sinks)
         {
-            processor.second->Flush();
-            processor.second->Stop();
+            if (processor.second)
+            {
+                processor.second->Flush();
+                processor.second->Stop();
+            }
         }
+
+        // Clear working logger processors registry
+        instance.Publish(nullptr);
+    }
+
+    // Flush logger processors of pending registry snapshots without waiting for producer threads
+    CppCommon::Locker<CppCommon::CriticalSection> retire_locker(instance._retire_lock);
+    for (auto& retired : instance._retired)
+        for (auto& processor : retired->registry->sinks)
+            if (processor.second && processor.second->IsStarted())
+                processor.second->Flush();
+}
+
+void Config::Register(Internals::Producer& producer)
+{
+    Config& instance = GetInstance();
+
+    // Unregister the producer thread on its exit
+    thread_local ProducerExit guard;
+
+    CppCommon::Locker<CppCommon::CriticalSection> locker(instance._retire_lock);
+
+    instance._producers.push_back(&producer);
+    producer._registered = true;
+}
+
+void Config::Unregister(Internals::Producer& producer)
+{
+    Config& instance = GetInstance();
+
+    CppCommon::Locker<CppCommon::CriticalSection> locker(instance._retire_lock);
+
+    instance._producers.erase(std::remove(instance._producers.begin(), instance._producers.end(), &producer), instance._producers.end());
+    producer._registered = false;
+    producer._exited = true;
+}
+
+void Config::Publish(std::unique_ptr<Registry> registry)
+{
+    // Publish the new registry snapshot with the next epoch
+    uint64_t epoch = Internals::ConfigEpoch.load(std::memory_order_relaxed) + 1;
+    if (registry)
+        registry->epoch = epoch;
+    std::unique_ptr<const Registry> previous(_registry.exchange(registry.release(), std::memory_order_acq_rel));
+    Internals::ConfigEpoch.store(epoch, std::memory_order_release);
+    if (!previous)
+        return;
+
+    auto retired = std::make_unique<Retired>();
+    retired->epoch = epoch;
+    retired->timestamp = CppCommon::Timestamp::nano();
+    retired->registry = std::move(previous);
+
+    // Keep the previous registry snapshot until producer threads leave it
+    {
+        CppCommon::Locker<CppCommon::CriticalSection> locker(_retire_lock);
+        _retired.push_back(std::move(retired));
     }
 
-    // Clear working logger processors map
-    instance._working.clear();
+    // Start the retire thread on demand
+    if (!_retire_thread.joinable())
+        _retire_thread = CppCommon::Thread::Start([this]() { RetireThread(); });
+
+    _retire_queue.Enqueue(epoch);
+}
+
+void Config::RetireThread()
+{
+    uint64_t epoch;
+    while (_retire_queue.Dequeue(epoch))
+    {
+        // Stop the retire thread
+        if (epoch == 0)
+            break;
+
+        // Wait until producer threads leave all retired registry snapshots
+        while (!_retire_stop && !Release(false))
+            CppCommon::Thread::Sleep(10);
+    }
+}
+
+bool Config::Release(bool force)
+{
+    std::vector<std::unique_ptr<Retired>> released;
+    bool pending;
+    {
+        CppCommon::Locker<CppCommon::CriticalSection> locker(_retire_lock);
+
+        // Find the oldest configuration epoch announced by producer threads
+        uint64_t announced = std::numeric_limits<uint64_t>::max();
+        for (auto producer : _producers)
+            announced = std::min(announced, producer->_epoch.load(std::memory_order_acquire));
+
+        // Take registry snapshots replaced not later than the announced epoch and retired longer than the grace period
+        uint64_t timestamp = CppCommon::Timestamp::nano();
+        while (!_retired.empty())
+        {
+            Retired& retired = *_retired.front();
+            if (!force && ((retired.epoch > announced) || ((timestamp - retired.timestamp) < (uint64_t)RETIRE_DELAY.total())))
+                break;
+
+            released.push_back(std::move(_retired.front()));
+            _retired.pop_front();
+        }
+        pending = !_retired.empty();
+    }
+
+    if (released.empty())
+        return !pending;
+
+    // Collect logger processors removed from the current registry snapshot
+    std::vector<std::shared_ptr<Processor>> processors;
+    const Registry* current = _registry.load(std::memory_order_acquire);
+    for (auto& retired : released)
+    {
+        for (auto& processor : retired->registry->sinks)
+        {
+            if (!processor.second || (std::find(processors.begin(), processors.end(), processor.second) != processors.end()))
+                continue;
+
+            bool used = false;
+            if (current != nullptr)
+                for (auto& sink : current->sinks)
+                    if (sink.second == processor.second)
+                        used = true;
+
+            if (!used)
+                processors.push_back(processor.second);
+        }
+    }
+
+    // Flush retired logger processors, producer threads do not use them anymore
+    for (auto& processor : processors)
+        if (processor->IsStarted())
+            processor->Flush();
+
+    {
+        CppCommon::Locker<CppCommon::CriticalSection> locker(_lock);
+
+        // Release retired registry snapshots
+        released.clear();
+
+        // Collect all elements of the current registry snapshot under the lock, so they cannot be changed by Startup()
+        std::unordered_set<const Element*> reachable;
+        current = _registry.load(std::memory_order_acquire);
+        if (current != nullptr)
+            for (auto& sink : current->sinks)
+                if (sink.second)
+                    Reach(*sink.second, reachable);
+
+        // Detach shared elements from the last references to retired logger processors,
+        // so their destructors will not stop layouts, filters and appenders still in use
+        for (auto& processor : processors)
+            if ((processor.use_count() == 1) && (reachable.find(processor.get()) == reachable.end()))
+                Detach(*processor, reachable);
+    }
+
+    // Release retired logger processors outside the lock
+    processors.clear();
+
+    return !pending;
 }
 
 } // namespace CppLogging
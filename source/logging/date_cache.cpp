@@ -0,0 +1,175 @@
+/*!
+    \file date_cache.cpp
+    \brief Date & time strings cache implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/date_cache.h"
+
+#include "time/time.h"
+
+#include <atomic>
+#include <cstring>
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+namespace {
+
+// Published date & time entry with the range of seconds where its local timezone offset is valid
+struct Snapshot
+{
+    DateCache::Entry entry;
+    int64_t begin;
+    int64_t end;
+};
+
+const size_t SNAPSHOT_WORDS = (sizeof(Snapshot) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+// Seqlock of the published snapshot: odd sequence means the snapshot is being written, zero means nothing is published yet
+std::atomic<uint64_t> sequence{0};
+std::atomic<uint64_t> words[SNAPSHOT_WORDS];
+
+bool Read(Snapshot& snapshot)
+{
+    uint64_t before = sequence.load(std::memory_order_acquire);
+    if ((before == 0) || ((before & 1) != 0))
+        return false;
+
+    uint64_t buffer[SNAPSHOT_WORDS];
+    for (size_t i = 0; i < SNAPSHOT_WORDS; ++i)
+        buffer[i] = words[i].load(std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) != before)
+        return false;
+
+    std::memcpy(&snapshot, buffer, sizeof(Snapshot));
+    return true;
+}
+
+void Publish(const Snapshot& snapshot)
+{
+    // Skip publishing if another thread is publishing right now
+    uint64_t before = sequence.load(std::memory_order_relaxed);
+    if (((before & 1) != 0) || !sequence.compare_exchange_strong(before, before + 1, std::memory_order_relaxed))
+        return;
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint64_t buffer[SNAPSHOT_WORDS] = {};
+    std::memcpy(buffer, &snapshot, sizeof(Snapshot));
+    for (size_t i = 0; i < SNAPSHOT_WORDS; ++i)
+        words[i].store(buffer[i], std::memory_order_relaxed);
+
+    sequence.store(before + 2, std::memory_order_release);
+}
+
+void ConvertNumber(char* output, int64_t number, size_t size)
+{
+    // Output digits from the last one
+    for (size_t i = size; i > 0; --i)
+    {
+        output[i - 1] = '0' + (char)(number % 10);
+        number /= 10;
+    }
+}
+
+void Render(int64_t seconds, DateCache::DateTime& datetime)
+{
+    // Split the timestamp into days and seconds of the day
+    int64_t days = seconds / 86400;
+    int64_t time = seconds % 86400;
+    if (time < 0)
+    {
+        time += 86400;
+        --days;
+    }
+
+    // Convert days into the civil date of the proleptic Gregorian calendar
+    days += 719468;
+    int64_t era = ((days >= 0) ? days : (days - 146096)) / 146097;
+    int64_t doe = days - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    int64_t day = doy - (153 * mp + 2) / 5 + 1;
+    int64_t month = (mp < 10) ? (mp + 3) : (mp - 9);
+    int64_t year = yoe + era * 400 + ((month <= 2) ? 1 : 0);
+
+    ConvertNumber(datetime.year, year, sizeof(datetime.year));
+    ConvertNumber(datetime.month, month, sizeof(datetime.month));
+    ConvertNumber(datetime.day, day, sizeof(datetime.day));
+    ConvertNumber(datetime.hour, time / 3600, sizeof(datetime.hour));
+    ConvertNumber(datetime.minute, (time / 60) % 60, sizeof(datetime.minute));
+    ConvertNumber(datetime.second, time % 60, sizeof(datetime.second));
+}
+
+int64_t LocalOffset(int64_t seconds)
+{
+    // Local timezone offset in seconds resolved with the system timezone rules
+    CppCommon::Timestamp timestamp((uint64_t)seconds * 1000000000ull);
+    CppCommon::UtcTime utc(timestamp);
+    CppCommon::LocalTime local(timestamp);
+
+    // Local date differs from UTC date at most by one day
+    int64_t days = 0;
+    if ((local.year() != utc.year()) || (local.month() != utc.month()) || (local.day() != utc.day()))
+        days = ((local.year() < utc.year()) || ((local.year() == utc.year()) && ((local.month() < utc.month()) || ((local.month() == utc.month()) && (local.day() < utc.day()))))) ? -1 : 1;
+
+    return days * 86400 + (local.hour() - utc.hour()) * 3600 + (local.minute() - utc.minute()) * 60 + (local.second() - utc.second());
+}
+
+void Resolve(int64_t seconds, Snapshot& snapshot)
+{
+    // Daylight saving time is never switched twice in an hour, so the same offset at the beginning and at the end of the hour is valid for the whole hour
+    int64_t begin = (seconds / 3600) * 3600;
+    int64_t end = begin + 3600;
+    int64_t offset = LocalOffset(begin);
+    if (LocalOffset(end - 1) != offset)
+    {
+        begin = seconds;
+        end = seconds + 1;
+        offset = LocalOffset(seconds);
+    }
+
+    snapshot.entry.offset = offset / 60;
+    snapshot.begin = begin;
+    snapshot.end = end;
+}
+
+} // namespace
+
+//! @endcond
+
+void DateCache::Get(uint64_t seconds, Entry& entry)
+{
+    // Take the published entry of the same second
+    Snapshot snapshot;
+    bool published = Read(snapshot);
+    if (published && (snapshot.entry.seconds == seconds))
+    {
+        entry = snapshot.entry;
+        return;
+    }
+    uint64_t latest = published ? snapshot.entry.seconds : 0;
+
+    // Resolve the local timezone offset out of the published range
+    if (!published || ((int64_t)seconds < snapshot.begin) || ((int64_t)seconds >= snapshot.end))
+        Resolve((int64_t)seconds, snapshot);
+
+    // Render UTC and local date & time
+    snapshot.entry.seconds = seconds;
+    Render((int64_t)seconds, snapshot.entry.utc);
+    Render((int64_t)seconds + snapshot.entry.offset * 60, snapshot.entry.local);
+    entry = snapshot.entry;
+
+    // Publish only newer seconds, so delayed logging records never replace the current second
+    if (seconds > latest)
+        Publish(snapshot);
+}
+
+} // namespace CppLogging
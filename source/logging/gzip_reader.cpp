@@ -0,0 +1,180 @@
+/*!
+    \file gzip_reader.cpp
+    \brief Gzip file reader implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/gzip_reader.h"
+
+#include "errors/exceptions.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <zlib.h>
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+struct GzipReader::Inflater
+{
+    z_stream stream;
+
+    explicit Inflater(const CppCommon::Path& path)
+    {
+        // Initialize the inflate stream with the gzip header
+        std::memset(&stream, 0, sizeof(stream));
+        if (inflateInit2(&stream, MAX_WBITS + 16) != Z_OK)
+            throwex CppCommon::FileSystemException("Cannot initialize zlib inflate stream!").Attach(path);
+    }
+
+    ~Inflater()
+    {
+        inflateEnd(&stream);
+    }
+};
+
+//! @endcond
+
+GzipReader::GzipReader(const CppCommon::Path& path) : _path(path), _file(path), _input(BUFFER_SIZE)
+{
+    // Open a gzip file
+    _file.Open(true, false);
+
+    _inflater = std::make_unique<Inflater>(path);
+}
+
+GzipReader::~GzipReader() = default;
+
+size_t GzipReader::Read(void* buffer, size_t size)
+{
+    size_t result = 0;
+    while (result < size)
+    {
+        // Inflate the next complete deflate blocks
+        if ((_offset == _ready) && !Inflate())
+            break;
+
+        size_t count = std::min(size - result, _ready - _offset);
+        std::memcpy((uint8_t*)buffer + result, _output.data() + _offset, count);
+        _offset += count;
+        result += count;
+    }
+    return result;
+}
+
+uint64_t GzipReader::offset() const noexcept
+{
+    return _position - _inflater->stream.avail_in;
+}
+
+bool GzipReader::Inflate()
+{
+    z_stream& stream = _inflater->stream;
+
+    // Only the output up to the sync flush point or the end of the gzip member is returned,
+    // so the torn or corrupted logging records written after the last sync never get into the output
+    _output.erase(_output.begin(), _output.begin() + _offset);
+    _ready -= _offset;
+    _offset = 0;
+
+    while (_ready == 0)
+    {
+        // Read the next compressed data, the torn tail of the last gzip member ends the stream
+        if ((stream.avail_in == 0) && !Fill())
+        {
+            _skipped += _position - _valid;
+            return false;
+        }
+
+        size_t size = _output.size();
+        _output.resize(size + BUFFER_SIZE);
+        stream.next_out = _output.data() + size;
+        stream.avail_out = (uInt)BUFFER_SIZE;
+        const Bytef* input = stream.next_in;
+        int result = inflate(&stream, Z_BLOCK);
+        _output.resize(_output.size() - stream.avail_out);
+
+        // Keep the last four consumed bytes to detect the empty stored block of the sync flush
+        for (const Bytef* it = std::max(input, (const Bytef*)stream.next_in - 4); it < stream.next_in; ++it)
+            _tail = (_tail << 8) | *it;
+
+        if (result == Z_STREAM_END)
+        {
+            // Continue with the next gzip member
+            Commit();
+            inflateReset(&stream);
+        }
+        else if (result == Z_DATA_ERROR)
+        {
+            // Resynchronize with the next gzip member after the last sync flush point
+            _output.clear();
+            if (!Resync())
+                return false;
+        }
+        else if ((result != Z_OK) && (result != Z_BUF_ERROR))
+            throwex CppCommon::FileSystemException("Cannot inflate the gzip file!").Attach(_path);
+        else if (((stream.data_type & 128) != 0) && ((_tail == 0x0000FFFF) || (_output.size() >= PENDING_SIZE)))
+            Commit();
+    }
+    return true;
+}
+
+void GzipReader::Commit()
+{
+    _ready = _output.size();
+    _valid = offset();
+}
+
+bool GzipReader::Fill()
+{
+    z_stream& stream = _inflater->stream;
+
+    // Keep the remaining compressed data and read more after it
+    std::memmove(_input.data(), stream.next_in, stream.avail_in);
+    size_t count = _file.Read(_input.data() + stream.avail_in, _input.size() - stream.avail_in);
+    if (count == 0)
+        return false;
+    stream.next_in = _input.data();
+    stream.avail_in += (uInt)count;
+    _position += count;
+    return true;
+}
+
+bool GzipReader::Resync()
+{
+    z_stream& stream = _inflater->stream;
+
+    inflateReset(&stream);
+    _file.Seek(_valid);
+    _position = _valid;
+    stream.avail_in = 0;
+    for (;;)
+    {
+        // Search the gzip member header magic
+        while (stream.avail_in >= 3)
+        {
+            if ((stream.next_in[0] == 0x1F) && (stream.next_in[1] == 0x8B) && (stream.next_in[2] == Z_DEFLATED))
+            {
+                // Search after this header next time if it is corrupted as well
+                _skipped += offset() - _valid;
+                _valid = offset() + 1;
+                return true;
+            }
+            ++stream.next_in;
+            --stream.avail_in;
+        }
+
+        if (!Fill())
+        {
+            _skipped += _position - _valid;
+            _valid = _position;
+            return false;
+        }
+    }
+}
+
+} // namespace CppLogging
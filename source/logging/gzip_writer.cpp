@@ -0,0 +1,126 @@
+/*!
+    \file gzip_writer.cpp
+    \brief Gzip stream writer implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/gzip_writer.h"
+
+#include "errors/fatal.h"
+
+#include <cassert>
+#include <cstring>
+
+#include <zlib.h>
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+struct GzipWriter::Deflater
+{
+    z_stream stream;
+
+    explicit Deflater(int level)
+    {
+        std::memset(&stream, 0, sizeof(stream));
+        if (deflateInit2(&stream, level, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throwex CppCommon::RuntimeException("Cannot initialize zlib deflate stream!");
+    }
+
+    ~Deflater()
+    {
+        deflateEnd(&stream);
+    }
+};
+
+//! @endcond
+
+GzipWriter::GzipWriter(int level, size_t sync) : _level(level), _sync(sync), _buffer(65536)
+{
+    assert(((level >= Z_DEFAULT_COMPRESSION) && (level <= Z_BEST_COMPRESSION)) && "Compression level should be in range [-1, 9]!");
+    if ((level < Z_DEFAULT_COMPRESSION) || (level > Z_BEST_COMPRESSION))
+        throwex CppCommon::ArgumentException("Compression level should be in range [-1, 9]!");
+}
+
+GzipWriter::~GzipWriter() = default;
+
+void GzipWriter::Open(CppCommon::File& file)
+{
+    if (!_deflater)
+        _deflater = std::make_unique<Deflater>(_level);
+    else
+        deflateReset(&_deflater->stream);
+
+    _file = &file;
+    _pending = 0;
+}
+
+void GzipWriter::Close()
+{
+    if (!IsOpened())
+        return;
+
+    // Write the gzip member trailer and detach the file even in case of any IO error
+    _deflater->stream.next_in = nullptr;
+    _deflater->stream.avail_in = 0;
+    try
+    {
+        Deflate(Z_FINISH);
+    }
+    catch (...)
+    {
+        _file = nullptr;
+        throw;
+    }
+    _file = nullptr;
+}
+
+void GzipWriter::Write(const void* buffer, size_t size)
+{
+    if (!IsOpened())
+        return;
+
+    _deflater->stream.next_in = (Bytef*)buffer;
+    _deflater->stream.avail_in = (uInt)size;
+    Deflate(Z_NO_FLUSH);
+
+    // Synchronize the deflate stream after the sync flush interval
+    _pending += size;
+    if ((_sync > 0) && (_pending >= _sync))
+        Flush();
+}
+
+void GzipWriter::Flush()
+{
+    if (!IsOpened())
+        return;
+
+    _deflater->stream.next_in = nullptr;
+    _deflater->stream.avail_in = 0;
+    Deflate(Z_SYNC_FLUSH);
+    _file->Flush();
+    _pending = 0;
+}
+
+void GzipWriter::Deflate(int flush)
+{
+    z_stream& stream = _deflater->stream;
+    int result;
+    do
+    {
+        stream.next_out = (Bytef*)_buffer.data();
+        stream.avail_out = (uInt)_buffer.size();
+        result = deflate(&stream, flush);
+        if ((result != Z_OK) && (result != Z_STREAM_END) && (result != Z_BUF_ERROR))
+            throwex CppCommon::RuntimeException("Cannot compress data with zlib deflate!");
+
+        size_t size = _buffer.size() - stream.avail_out;
+        if (size > 0)
+            _file->Write(_buffer.data(), size);
+    } while ((stream.avail_out == 0) || (stream.avail_in > 0));
+}
+
+} // namespace CppLogging
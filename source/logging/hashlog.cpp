@@ -0,0 +1,295 @@
+/*!
+    \file hashlog.cpp
+    \brief Hash logs map implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/hashlog.h"
+
+#include "filesystem/file.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppLogging {
+
+Hashlog::~Hashlog()
+{
+    Unmap();
+}
+
+bool Hashlog::Find(uint64_t hash, std::string_view& value) const
+{
+    // Find in read or inserted entries
+    auto string = _strings.find(hash);
+    if (string != _strings.end())
+    {
+        value = string->second;
+        return true;
+    }
+
+    // Find in journal entries
+    auto journal = _journal.find(hash);
+    if (journal != _journal.end())
+    {
+        value = journal->second;
+        return true;
+    }
+
+    // Find in the sorted table
+    return FindIndex(hash, value);
+}
+
+bool Hashlog::FindIndex(uint64_t hash, std::string_view& value) const
+{
+    // Binary search in the sorted index
+    size_t first = 0;
+    size_t last = _count;
+    while (first < last)
+    {
+        size_t middle = first + (last - first) / 2;
+        uint64_t current;
+        std::memcpy(&current, _index + middle * ENTRY_SIZE, sizeof(uint64_t));
+        if (current < hash)
+            first = middle + 1;
+        else if (current > hash)
+            last = middle;
+        else
+        {
+            uint32_t offset, length;
+            std::memcpy(&offset, _index + middle * ENTRY_SIZE + 8, sizeof(uint32_t));
+            std::memcpy(&length, _index + middle * ENTRY_SIZE + 12, sizeof(uint32_t));
+            if ((offset > _blob_size) || (length > (_blob_size - offset)))
+                return false;
+            value = std::string_view((const char*)_blob + offset, length);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Hashlog::Insert(uint64_t hash, std::string_view value)
+{
+    std::string_view existing;
+    if (Find(hash, existing))
+        return (existing == value);
+
+    _strings.emplace(hash, value);
+    _pending.push_back(hash);
+    return true;
+}
+
+void Hashlog::Clear()
+{
+    Unmap();
+    _strings.clear();
+    _pending.clear();
+}
+
+bool Hashlog::Read(const CppCommon::Path& path)
+{
+    Clear();
+
+    if (!_file.Map(path))
+        return false;
+
+    const uint8_t* data = _file.data();
+    size_t size = _file.size();
+
+    // Read the hash logs map version 2
+    if ((size >= HEADER_SIZE) && (std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0))
+    {
+        uint32_t count;
+        uint64_t journal;
+        std::memcpy(&count, data + 4, sizeof(uint32_t));
+        std::memcpy(&journal, data + 8, sizeof(uint64_t));
+        if ((count > ((size - HEADER_SIZE) / ENTRY_SIZE)) || (journal < (HEADER_SIZE + count * ENTRY_SIZE)) || (journal > size))
+        {
+            Clear();
+            return false;
+        }
+
+        _index = data + HEADER_SIZE;
+        _blob = _index + count * ENTRY_SIZE;
+        _blob_size = (size_t)journal - HEADER_SIZE - count * ENTRY_SIZE;
+        _count = count;
+
+        // Parse journal entries until the torn tail
+        size_t offset = (size_t)journal;
+        while ((size - offset) >= JOURNAL_ENTRY_SIZE)
+        {
+            uint64_t hash;
+            uint32_t length;
+            std::memcpy(&hash, data + offset, sizeof(uint64_t));
+            std::memcpy(&length, data + offset + 8, sizeof(uint32_t));
+            if ((size - offset - JOURNAL_ENTRY_SIZE) < length)
+                break;
+            _journal[hash] = std::string_view((const char*)data + offset + JOURNAL_ENTRY_SIZE, length);
+            offset += JOURNAL_ENTRY_SIZE + length;
+        }
+        _end = offset;
+        return true;
+    }
+
+    // Read the hash logs map version 1 into memory
+    bool result = (size >= sizeof(uint32_t));
+    if (result)
+    {
+        uint32_t count;
+        std::memcpy(&count, data, sizeof(uint32_t));
+        size_t offset = sizeof(uint32_t);
+        while (count-- > 0)
+        {
+            if ((size - offset) < (sizeof(uint32_t) + sizeof(uint16_t)))
+            {
+                result = false;
+                break;
+            }
+            uint32_t hash;
+            uint16_t length;
+            std::memcpy(&hash, data + offset, sizeof(uint32_t));
+            std::memcpy(&length, data + offset + 4, sizeof(uint16_t));
+            offset += sizeof(uint32_t) + sizeof(uint16_t);
+            if ((size - offset) < length)
+            {
+                result = false;
+                break;
+            }
+            _strings[hash].assign((const char*)data + offset, length);
+            offset += length;
+        }
+    }
+
+    // Version 1 file is not used after reading
+    Unmap();
+    return result;
+}
+
+void Hashlog::Write(const CppCommon::Path& path)
+{
+    // Collect all entries sorted by hash
+    std::vector<std::pair<uint64_t, std::string_view>> entries;
+    entries.reserve(size());
+    for (const auto& entry : _strings)
+        entries.emplace_back(entry.first, entry.second);
+    for (const auto& entry : _journal)
+        entries.emplace_back(entry.first, entry.second);
+    for (size_t i = 0; i < _count; ++i)
+    {
+        uint64_t hash;
+        std::string_view value;
+        std::memcpy(&hash, _index + i * ENTRY_SIZE, sizeof(uint64_t));
+        if (FindIndex(hash, value))
+            entries.emplace_back(hash, value);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    // Prepare the hash logs map version 2
+    uint32_t count = (uint32_t)entries.size();
+    std::vector<uint8_t> buffer(HEADER_SIZE + count * ENTRY_SIZE);
+    uint8_t* index = buffer.data() + HEADER_SIZE;
+    uint32_t offset = 0;
+    for (const auto& entry : entries)
+    {
+        uint32_t length = (uint32_t)entry.second.size();
+        std::memcpy(index, &entry.first, sizeof(uint64_t));
+        std::memcpy(index + 8, &offset, sizeof(uint32_t));
+        std::memcpy(index + 12, &length, sizeof(uint32_t));
+        index += ENTRY_SIZE;
+        offset += length;
+    }
+    for (const auto& entry : entries)
+        buffer.insert(buffer.end(), entry.second.begin(), entry.second.end());
+    uint64_t journal = buffer.size();
+    std::memcpy(buffer.data(), MAGIC, sizeof(MAGIC));
+    std::memcpy(buffer.data() + 4, &count, sizeof(uint32_t));
+    std::memcpy(buffer.data() + 8, &journal, sizeof(uint64_t));
+
+    // Skip writing the same .hashlog to avoid unnecessary rebuilds of dependent targets
+    CppCommon::File hashlog(path);
+    if (hashlog.IsFileExists() && (hashlog.size() == buffer.size()))
+    {
+        std::vector<uint8_t> existing(buffer.size());
+        hashlog.Open(true, false);
+        bool same = (hashlog.Read(existing.data(), existing.size()) == existing.size()) && (existing == buffer);
+        hashlog.Close();
+        if (same)
+        {
+            _pending.clear();
+            return;
+        }
+    }
+
+    // Keep all entries in memory while the file is rewritten
+    if (_file)
+    {
+        for (const auto& entry : entries)
+            _strings.emplace(entry.first, entry.second);
+        _journal.clear();
+        Unmap();
+    }
+
+    // Write .hashlog file
+    hashlog.OpenOrCreate(false, true, true);
+    hashlog.Write(buffer.data(), buffer.size());
+    hashlog.Close();
+    _pending.clear();
+}
+
+void Hashlog::Append(const CppCommon::Path& path)
+{
+    // Write the whole hash logs map if the journal is not available
+    if (!_file || (_index == nullptr) || (path != _file.path()))
+    {
+        Write(path);
+        return;
+    }
+
+    if (_pending.empty())
+        return;
+
+    // Prepare journal entries
+    std::vector<uint8_t> buffer;
+    for (auto hash : _pending)
+    {
+        const std::string& value = _strings[hash];
+        uint32_t length = (uint32_t)value.size();
+        buffer.insert(buffer.end(), (const uint8_t*)&hash, (const uint8_t*)&hash + sizeof(uint64_t));
+        buffer.insert(buffer.end(), (const uint8_t*)&length, (const uint8_t*)&length + sizeof(uint32_t));
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    // Append journal entries after the last valid journal entry
+    size_t end = _end;
+    Unmap();
+    CppCommon::File hashlog(path);
+    hashlog.Open(false, true);
+    hashlog.Resize(end);
+    hashlog.Seek(end);
+    hashlog.Write(buffer.data(), buffer.size());
+    hashlog.Close();
+    _pending.clear();
+
+    // Map the updated file and keep inserted entries in memory
+    std::map<uint64_t, std::string> strings;
+    std::swap(strings, _strings);
+    Read(path);
+    for (auto& entry : strings)
+        if (_journal.find(entry.first) == _journal.end())
+            _strings.emplace(entry.first, std::move(entry.second));
+}
+
+void Hashlog::Unmap()
+{
+    _file.Unmap();
+    _index = nullptr;
+    _blob = nullptr;
+    _blob_size = 0;
+    _count = 0;
+    _journal.clear();
+    _end = 0;
+}
+
+} // namespace CppLogging
@@ -0,0 +1,273 @@
+/*!
+    \file binary_layout_v2.cpp
+    \brief Binary layout version 2 implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/layouts/binary_layout_v2.h"
+
+#include "errors/exceptions.h"
+
+#include <cassert>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <nmmintrin.h>
+#define CPPLOGGING_CRC32C_SSE42 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <nmmintrin.h>
+#define CPPLOGGING_CRC32C_SSE42 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CPPLOGGING_CRC32C_ARM 1
+#endif
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+namespace {
+
+class CRC32CTable
+{
+public:
+    uint32_t table[8][256];
+
+    CRC32CTable()
+    {
+        // Reflected Castagnoli polynomial
+        const uint32_t polynomial = 0x82F63B78;
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; ++j)
+                crc = (crc & 1) ? ((crc >> 1) ^ polynomial) : (crc >> 1);
+            table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i)
+            for (int j = 1; j < 8; ++j)
+                table[j][i] = (table[j - 1][i] >> 8) ^ table[0][table[j - 1][i] & 0xFF];
+    }
+};
+
+uint32_t CRC32CSoftware(const uint8_t* data, size_t size, uint32_t crc)
+{
+    static const CRC32CTable crc32c;
+    const auto& table = crc32c.table;
+
+    // Slicing-by-8 software implementation
+    while (size >= 8)
+    {
+        uint32_t low;
+        uint32_t high;
+        std::memcpy(&low, data, sizeof(uint32_t));
+        std::memcpy(&high, data + 4, sizeof(uint32_t));
+        low ^= crc;
+        crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+              table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+        data += 8;
+        size -= 8;
+    }
+    while (size-- > 0)
+        crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xFF];
+
+    return crc;
+}
+
+#if defined(CPPLOGGING_CRC32C_SSE42)
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("sse4.2")))
+#endif
+uint32_t CRC32CHardware(const uint8_t* data, size_t size, uint32_t crc)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t crc64 = crc;
+    while (size >= 8)
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(uint64_t));
+        crc64 = _mm_crc32_u64(crc64, value);
+        data += 8;
+        size -= 8;
+    }
+    crc = (uint32_t)crc64;
+#endif
+    while (size >= 4)
+    {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(uint32_t));
+        crc = _mm_crc32_u32(crc, value);
+        data += 4;
+        size -= 4;
+    }
+    while (size-- > 0)
+        crc = _mm_crc32_u8(crc, *data++);
+
+    return crc;
+}
+
+bool CRC32CHardwareSupported()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_cpu_supports("sse4.2");
+#else
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 20)) != 0;
+#endif
+}
+
+#elif defined(CPPLOGGING_CRC32C_ARM)
+
+uint32_t CRC32CHardware(const uint8_t* data, size_t size, uint32_t crc)
+{
+    while (size >= 8)
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(uint64_t));
+        crc = __crc32cd(crc, value);
+        data += 8;
+        size -= 8;
+    }
+    while (size-- > 0)
+        crc = __crc32cb(crc, *data++);
+
+    return crc;
+}
+
+bool CRC32CHardwareSupported() { return true; }
+
+#endif
+
+} // namespace
+
+//! @endcond
+
+BinaryLayoutV2::BinaryLayoutV2(size_t sync_interval) : _sync_interval(sync_interval)
+{
+    assert((sync_interval > 0) && "Sync interval should be greater than zero!");
+    if (sync_interval == 0)
+        throwex CppCommon::ArgumentException("Sync interval should be greater than zero!");
+}
+
+uint32_t BinaryLayoutV2::CRC32C(const void* data, size_t size, uint32_t crc)
+{
+    const uint8_t* buffer = (const uint8_t*)data;
+
+    crc = ~crc;
+#if defined(CPPLOGGING_CRC32C_SSE42) || defined(CPPLOGGING_CRC32C_ARM)
+    static const bool hardware = CRC32CHardwareSupported();
+    crc = hardware ? CRC32CHardware(buffer, size, crc) : CRC32CSoftware(buffer, size, crc);
+#else
+    crc = CRC32CSoftware(buffer, size, crc);
+#endif
+    return ~crc;
+}
+
+size_t BinaryLayoutV2::WriteVarint(uint8_t* buffer, uint64_t value)
+{
+    size_t size = 0;
+    while (value >= 0x80)
+    {
+        buffer[size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buffer[size++] = (uint8_t)value;
+    return size;
+}
+
+size_t BinaryLayoutV2::ReadVarint(const uint8_t* buffer, size_t size, uint64_t& value)
+{
+    value = 0;
+    for (size_t i = 0; (i < size) && (i < 10); ++i)
+    {
+        value |= (uint64_t)(buffer[i] & 0x7F) << (7 * i);
+        if ((buffer[i] & 0x80) == 0)
+            return i + 1;
+    }
+    return 0;
+}
+
+void BinaryLayoutV2::LayoutRecord(Record& record)
+{
+    // Check if the sync frame is required before the current logging record
+    bool first = (_records == 0);
+    bool sync = first || (_records >= _sync_interval) || ((record.timestamp / 1000000000) != (_timestamp / 1000000000));
+    if (sync)
+        _records = 0;
+    if (first)
+        _timestamp = record.timestamp;
+    ++_records;
+
+    // Calculate zigzag encoded timestamp delta from the previous logging record
+    int64_t delta = (int64_t)(record.timestamp - _timestamp);
+    uint64_t zigzag = ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+
+    // Calculate logging record payload size
+    uint8_t varint[10];
+    size_t payload_size = WriteVarint(varint, zigzag) + WriteVarint(varint, record.thread) + sizeof(Level) +
+                          WriteVarint(varint, record.logger.size()) + record.logger.size() +
+                          WriteVarint(varint, record.message.size()) + record.message.size() +
+                          WriteVarint(varint, record.buffer.size()) + record.buffer.size();
+
+    // Calculate logging record frame size
+    size_t size = (sync ? SYNC_SIZE : 0) + sizeof(uint8_t) + WriteVarint(varint, payload_size) + payload_size + sizeof(uint32_t);
+
+    // Resize the raw buffer to the required size
+    record.raw.resize(size + 1);
+
+    // Get the raw buffer start position
+    uint8_t* buffer = record.raw.data();
+
+    // Serialize the sync frame
+    if (sync)
+    {
+        uint8_t* frame = buffer;
+        std::memcpy(buffer, MAGIC, sizeof(MAGIC));
+        buffer += sizeof(MAGIC);
+        *buffer++ = VERSION;
+        *buffer++ = 0;
+        std::memcpy(buffer, &_timestamp, sizeof(uint64_t));
+        buffer += sizeof(uint64_t);
+        uint32_t crc = CRC32C(frame, buffer - frame);
+        std::memcpy(buffer, &crc, sizeof(uint32_t));
+        buffer += sizeof(uint32_t);
+    }
+
+    // Serialize the logging record frame header
+    *buffer++ = RECORD_TAG;
+    buffer += WriteVarint(buffer, payload_size);
+
+    // Serialize the logging record payload
+    uint8_t* payload = buffer;
+    buffer += WriteVarint(buffer, zigzag);
+    buffer += WriteVarint(buffer, record.thread);
+    std::memcpy(buffer, &record.level, sizeof(Level));
+    buffer += sizeof(Level);
+    buffer += WriteVarint(buffer, record.logger.size());
+    std::memcpy(buffer, record.logger.data(), record.logger.size());
+    buffer += record.logger.size();
+    buffer += WriteVarint(buffer, record.message.size());
+    std::memcpy(buffer, record.message.data(), record.message.size());
+    buffer += record.message.size();
+    buffer += WriteVarint(buffer, record.buffer.size());
+    std::memcpy(buffer, record.buffer.data(), record.buffer.size());
+    buffer += record.buffer.size();
+
+    // Serialize the logging record payload checksum
+    uint32_t crc = CRC32C(payload, payload_size);
+    std::memcpy(buffer, &crc, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+
+    // Write the last zero byte
+    *buffer = 0;
+
+    // Update the previous logging record timestamp
+    _timestamp = record.timestamp;
+}
+
+} // namespace CppLogging
@@ -0,0 +1,93 @@
+/*!
+    \file dictionary_layout.cpp
+    \brief Dictionary layout implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/layouts/dictionary_layout.h"
+
+#include <cstring>
+
+namespace CppLogging {
+
+void DictionaryLayout::LayoutRecord(Record& record)
+{
+    // Reset the dictionary when the logging record is laid out for another logging file
+    if ((record.generation != 0) && (record.generation != _generation))
+    {
+        Reset();
+        _generation = record.generation;
+    }
+    record.generation = _generation;
+    record.layout = this;
+
+    // Calculate hashes and check if dictionary entries are required
+    uint32_t logger_hash = HashLayout::Hash(record.logger);
+    uint32_t message_hash = HashLayout::Hash(record.message);
+    bool logger_entry = _loggers.insert(logger_hash).second;
+    bool message_entry = _messages.insert(message_hash).second;
+
+    // Calculate dictionary entries size
+    size_t entries = 0;
+    if (logger_entry)
+        entries += sizeof(uint32_t) + sizeof(uint32_t) + record.logger.size();
+    if (message_entry)
+        entries += sizeof(uint32_t) + sizeof(uint32_t) + record.message.size();
+
+    // Calculate logging record size
+    uint32_t size = (uint32_t)(sizeof(uint64_t) + sizeof(uint64_t) + sizeof(Level) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint32_t) + record.buffer.size());
+
+    // Resize the raw buffer to the required size
+    record.raw.resize(entries + sizeof(uint32_t) + size + 1);
+
+    // Get the raw buffer start position
+    uint8_t* buffer = record.raw.data();
+
+    // Serialize dictionary entries
+    auto entry = [&buffer](uint32_t hash, const std::string& value)
+    {
+        uint32_t entry_size = (uint32_t)(sizeof(uint32_t) + value.size()) | DICTIONARY_FLAG;
+        std::memcpy(buffer, &entry_size, sizeof(uint32_t));
+        buffer += sizeof(uint32_t);
+        std::memcpy(buffer, &hash, sizeof(uint32_t));
+        buffer += sizeof(uint32_t);
+        std::memcpy(buffer, value.data(), value.size());
+        buffer += value.size();
+    };
+    if (logger_entry)
+        entry(logger_hash, record.logger);
+    if (message_entry)
+        entry(message_hash, record.message);
+
+    // Serialize the logging record
+    std::memcpy(buffer, &size, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+    std::memcpy(buffer, &record.timestamp, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+    std::memcpy(buffer, &record.thread, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+    std::memcpy(buffer, &record.level, sizeof(Level));
+    buffer += sizeof(Level);
+
+    // Serialize the logger name hash
+    std::memcpy(buffer, &logger_hash, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+
+    // Serialize the logging message hash
+    std::memcpy(buffer, &message_hash, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+
+    // Serialize the logging buffer
+    uint32_t buffer_size = (uint32_t)record.buffer.size();
+    std::memcpy(buffer, &buffer_size, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+    std::memcpy(buffer, record.buffer.data(), record.buffer.size());
+    buffer += record.buffer.size();
+
+    // Write the last zero byte
+    *buffer = 0;
+}
+
+} // namespace CppLogging
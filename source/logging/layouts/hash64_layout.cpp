@@ -0,0 +1,170 @@
+/*!
+    \file hash64_layout.cpp
+    \brief 64-bit hash layout implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/layouts/hash64_layout.h"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+
+namespace {
+
+const uint64_t SECRET[4] = { 0xA0761D6478BD642Full, 0xE7037ED1A0B428DBull, 0x8EBC6AF09C88C6E3ull, 0x589965CC75374CC3ull };
+
+inline void Multiply(uint64_t& a, uint64_t& b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    a = (uint64_t)r;
+    b = (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    a = _umul128(a, b, &b);
+#else
+    uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+    uint64_t c = (t < rl) ? 1 : 0;
+    uint64_t lo = t + (rm1 << 32);
+    c += (lo < t) ? 1 : 0;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline uint64_t Mix(uint64_t a, uint64_t b)
+{
+    Multiply(a, b);
+    return a ^ b;
+}
+
+inline uint64_t Read8(const uint8_t* p)
+{
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(uint64_t));
+    return value;
+}
+
+inline uint64_t Read4(const uint8_t* p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(uint32_t));
+    return value;
+}
+
+inline uint64_t Read3(const uint8_t* p, size_t k)
+{
+    return (((uint64_t)p[0]) << 16) | (((uint64_t)p[k >> 1]) << 8) | p[k - 1];
+}
+
+} // namespace
+
+//! @endcond
+
+uint64_t Hash64Layout::Hash(std::string_view message)
+{
+    const uint8_t* p = (const uint8_t*)message.data();
+    size_t size = message.size();
+
+    uint64_t seed = Mix(SECRET[0], SECRET[1]);
+    uint64_t a, b;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            a = (Read4(p) << 32) | Read4(p + ((size >> 3) << 2));
+            b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - ((size >> 3) << 2));
+        }
+        else if (size > 0)
+        {
+            a = Read3(p, size);
+            b = 0;
+        }
+        else
+            a = b = 0;
+    }
+    else
+    {
+        size_t i = size;
+        if (i > 48)
+        {
+            uint64_t see1 = seed, see2 = seed;
+            do
+            {
+                seed = Mix(Read8(p) ^ SECRET[1], Read8(p + 8) ^ seed);
+                see1 = Mix(Read8(p + 16) ^ SECRET[2], Read8(p + 24) ^ see1);
+                see2 = Mix(Read8(p + 32) ^ SECRET[3], Read8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16)
+        {
+            seed = Mix(Read8(p) ^ SECRET[1], Read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = Read8(p + i - 16);
+        b = Read8(p + i - 8);
+    }
+
+    a ^= SECRET[1];
+    b ^= seed;
+    Multiply(a, b);
+    return Mix(a ^ SECRET[0] ^ size, b ^ SECRET[1]);
+}
+
+void Hash64Layout::LayoutRecord(Record& record)
+{
+    // Calculate logging record size
+    uint32_t size = (uint32_t)(sizeof(uint64_t) + sizeof(uint64_t) + sizeof(Level) + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(uint32_t) + record.buffer.size());
+
+    // Resize the raw buffer to the required size
+    record.raw.resize(sizeof(uint32_t) + size + 1);
+
+    // Get the raw buffer start position
+    uint8_t* buffer = record.raw.data();
+
+    // Serialize the logging record
+    uint32_t flagged_size = size | HASH64_FLAG;
+    std::memcpy(buffer, &flagged_size, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+    std::memcpy(buffer, &record.timestamp, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+    std::memcpy(buffer, &record.thread, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+    std::memcpy(buffer, &record.level, sizeof(Level));
+    buffer += sizeof(Level);
+
+    // Serialize the logger name hash
+    uint64_t logger_hash = Hash(record.logger);
+    std::memcpy(buffer, &logger_hash, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+
+    // Serialize the logging message hash
+    uint64_t message_hash = Hash(record.message);
+    std::memcpy(buffer, &message_hash, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+
+    // Serialize the logging buffer
+    uint32_t buffer_size = (uint32_t)record.buffer.size();
+    std::memcpy(buffer, &buffer_size, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+    std::memcpy(buffer, record.buffer.data(), record.buffer.size());
+    buffer += record.buffer.size();
+
+    // Write the last zero byte
+    *buffer = 0;
+}
+
+} // namespace CppLogging
@@ -8,11 +8,14 @@
 
 #include "logging/layouts/text_layout.h"
 
+#include "logging/date_cache.h"
+
 #include "system/environment.h"
-#include "time/timezone.h"
+#include "time/timestamp.h"
 #include "utility/countof.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <cstring>
 #include <vector>
 
 namespace CppLogging {
@@ -209,37 +212,28 @@ public:
             {
                 cache_seconds = seconds;
 
+                // Take date & time rendered once per second for the whole process
+                DateCache::Entry date;
+                DateCache::Get(seconds, date);
+
                 // Update timezone cache values
                 if (cache_timezone_required || !cache_initizlied)
                 {
-                    CppCommon::Timezone local;
-                    ConvertTimezone(cache_local_timezone_str, local.total().minutes(), 6);
+                    ConvertTimezone(cache_local_timezone_str, date.offset, 6);
                     cache_update_datetime = true;
                 }
 
                 // Update UTC time cache values
                 if (cache_utc_required || !cache_initizlied)
                 {
-                    CppCommon::UtcTime utc(timestamp);
-                    ConvertNumber(cache_utc_year_str, utc.year(), 4);
-                    ConvertNumber(cache_utc_month_str, utc.month(), 2);
-                    ConvertNumber(cache_utc_day_str, utc.day(), 2);
-                    ConvertNumber(cache_utc_hour_str, utc.hour(), 2);
-                    ConvertNumber(cache_utc_minute_str, utc.minute(), 2);
-                    ConvertNumber(cache_utc_second_str, utc.second(), 2);
+                    ConvertDate(cache_utc_year_str, cache_utc_month_str, cache_utc_day_str, cache_utc_hour_str, cache_utc_minute_str, cache_utc_second_str, date.utc);
                     cache_update_datetime = true;
                 }
 
                 // Update local time cache values
                 if (cache_local_required || !cache_initizlied)
                 {
-                    CppCommon::LocalTime local(timestamp);
-                    ConvertNumber(cache_local_year_str, local.year(), 4);
-                    ConvertNumber(cache_local_month_str, local.month(), 2);
-                    ConvertNumber(cache_local_day_str, local.day(), 2);
-                    ConvertNumber(cache_local_hour_str, local.hour(), 2);
-                    ConvertNumber(cache_local_minute_str, local.minute(), 2);
-                    ConvertNumber(cache_local_second_str, local.second(), 2);
+                    ConvertDate(cache_local_year_str, cache_local_month_str, cache_local_day_str, cache_local_hour_str, cache_local_minute_str, cache_local_second_str, date.local);
                     cache_update_datetime = true;
                 }
             }
@@ -722,6 +716,16 @@ private:
         output[1] = 'x';
     }
 
+    static void ConvertDate(char* year, char* month, char* day, char* hour, char* minute, char* second, const DateCache::DateTime& datetime)
+    {
+        std::memcpy(year, datetime.year, sizeof(datetime.year));
+        std::memcpy(month, datetime.month, sizeof(datetime.month));
+        std::memcpy(day, datetime.day, sizeof(datetime.day));
+        std::memcpy(hour, datetime.hour, sizeof(datetime.hour));
+        std::memcpy(minute, datetime.minute, sizeof(datetime.minute));
+        std::memcpy(second, datetime.second, sizeof(datetime.second));
+    }
+
     static void ConvertTimezone(char* output, int64_t offset, size_t size)
     {
         // Prepare the output string
@@ -12,17 +12,35 @@
 
 namespace CppLogging {
 
-Logger::Logger() : _sink(Config::CreateLogger()._sink)
+Logger::Logger()
 {
+    Logger logger = Config::CreateLogger();
+    _epoch.store(logger._epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _sink.store(logger._sink.load(std::memory_order_relaxed), std::memory_order_relaxed);
 }
 
-Logger::Logger(const std::string& name) : _name(name), _sink(Config::CreateLogger(name)._sink)
+Logger::Logger(const std::string& name) : _name(name)
 {
+    Logger logger = Config::CreateLogger(name);
+    _epoch.store(logger._epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _sink.store(logger._sink.load(std::memory_order_relaxed), std::memory_order_relaxed);
 }
 
 void Logger::Update()
 {
-    _sink = Config::CreateLogger(_name)._sink;
+    // Invalidate the cached logger sink processor
+    _epoch.store(0, std::memory_order_release);
+}
+
+Processor* Logger::Resolve() const
+{
+    CppCommon::Locker<CppCommon::SpinLock> locker(_lock);
+
+    uint64_t epoch;
+    Processor* sink = Config::ResolveSink(_name, epoch);
+    _sink.store(sink, std::memory_order_relaxed);
+    _epoch.store(epoch, std::memory_order_release);
+    return sink;
 }
 
 } // namespace CppLogging
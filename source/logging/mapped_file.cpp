@@ -0,0 +1,93 @@
+/*!
+    \file mapped_file.cpp
+    \brief Memory-mapped file implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/mapped_file.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CppLogging {
+
+bool MappedFile::Map(const CppCommon::Path& path)
+{
+    Unmap();
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || (size.QuadPart == 0))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    _file = file;
+    _mapping = mapping;
+    _data = (const uint8_t*)data;
+    _size = (size_t)size.QuadPart;
+#else
+    int file = open(path.string().c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+    struct stat st;
+    if ((fstat(file, &st) != 0) || (st.st_size == 0))
+    {
+        close(file);
+        return false;
+    }
+    void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, file, 0);
+    close(file);
+    if (data == MAP_FAILED)
+        return false;
+    _data = (const uint8_t*)data;
+    _size = (size_t)st.st_size;
+#endif
+    _path = path;
+    return true;
+}
+
+void MappedFile::Unmap()
+{
+    if (_data == nullptr)
+        return;
+
+#if defined(_WIN32) || defined(_WIN64)
+    UnmapViewOfFile(_data);
+    CloseHandle((HANDLE)_mapping);
+    CloseHandle((HANDLE)_file);
+    _file = nullptr;
+    _mapping = nullptr;
+#else
+    munmap((void*)_data, _size);
+#endif
+    _path = CppCommon::Path();
+    _data = nullptr;
+    _size = 0;
+}
+
+} // namespace CppLogging
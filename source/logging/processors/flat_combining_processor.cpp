@@ -0,0 +1,145 @@
+/*!
+    \file flat_combining_processor.cpp
+    \brief Flat-combining logging processor implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/processors/flat_combining_processor.h"
+
+#include "errors/exceptions.h"
+#include "threads/thread.h"
+#include "utility/resource.h"
+
+#include <cassert>
+
+namespace CppLogging {
+
+FlatCombiningProcessor::FlatCombiningProcessor(const std::shared_ptr<Layout>& layout, size_t slots)
+    : Processor(layout),
+      _count(slots),
+      _slots(new Slot[slots])
+{
+    assert((slots > 0) && "Publication slots count should be greater than zero!");
+    if (slots == 0)
+        throwex CppCommon::ArgumentException("Publication slots count should be greater than zero!");
+}
+
+bool FlatCombiningProcessor::ProcessRecord(Record& record)
+{
+    // Check if the logging processor started
+    if (!IsStarted())
+        return true;
+
+    // Publish the given logging record
+    Slot& slot = PublishRecord(record);
+
+    // Wait until the logging record is processed by the current combiner
+    uint8_t state;
+    while (((state = slot.state.load(std::memory_order_acquire)) == SLOT_PENDING) || (state == SLOT_COMBINING))
+    {
+        // Try to become a combiner and process all pending logging records
+        if (_lock.TryLock())
+        {
+            // Release the combiner lock even if the combiner fails
+            auto locker = CppCommon::resource(&_lock, [](CppCommon::CriticalSection* lock) { lock->Unlock(); });
+            CombineRecords();
+        }
+        else
+            CppCommon::Thread::Yield();
+    }
+
+    // Take the error of the logging record processing
+    std::exception_ptr error = std::move(slot.error);
+    slot.error = nullptr;
+
+    // Release the publication slot
+    slot.record = nullptr;
+    slot.state.store(SLOT_FREE, std::memory_order_release);
+
+    // Rethrow the processing error to the owner of the logging record
+    if (error)
+        std::rethrow_exception(error);
+
+    // Return the processing result of the combiner
+    return (state == SLOT_PROCESSED);
+}
+
+FlatCombiningProcessor::Slot& FlatCombiningProcessor::PublishRecord(Record& record)
+{
+    // Thread local publication slot index
+    static std::atomic<size_t> counter{0};
+    thread_local size_t index = counter++;
+
+    // Find a free publication slot starting from the thread one
+    size_t current = index % _count;
+    for (size_t attempt = 1; ; ++attempt)
+    {
+        Slot& slot = _slots[current];
+
+        uint8_t expected = SLOT_FREE;
+        if (slot.state.compare_exchange_strong(expected, SLOT_CLAIMED, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            slot.record = &record;
+            slot.state.store(SLOT_PENDING, std::memory_order_release);
+            _pending.fetch_add(1, std::memory_order_release);
+            return slot;
+        }
+
+        // Yield if all publication slots are busy
+        if ((attempt % _count) == 0)
+            CppCommon::Thread::Yield();
+
+        current = (current + 1) % _count;
+    }
+}
+
+void FlatCombiningProcessor::CombineRecords()
+{
+    // Process all pending logging records in one pass
+    for (size_t i = 0; (i < _count) && (_pending.load(std::memory_order_acquire) > 0); ++i)
+    {
+        Slot& slot = _slots[i];
+
+        // Skip publication slots without pending logging records
+        if (slot.state.load(std::memory_order_relaxed) != SLOT_PENDING)
+            continue;
+
+        uint8_t expected = SLOT_PENDING;
+        if (slot.state.compare_exchange_strong(expected, SLOT_COMBINING, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            _pending.fetch_sub(1, std::memory_order_relaxed);
+
+            // Errors of filters, layouts and appenders are passed to the owner of the logging record
+            bool result = false;
+            try
+            {
+                result = Processor::ProcessRecord(*slot.record);
+            }
+            catch (...)
+            {
+                slot.error = std::current_exception();
+            }
+
+            slot.state.store(result ? SLOT_PROCESSED : SLOT_STOPPED, std::memory_order_release);
+        }
+    }
+}
+
+void FlatCombiningProcessor::Flush()
+{
+    // Check if the logging processor started
+    if (!IsStarted())
+        return;
+
+    CppCommon::Locker<CppCommon::CriticalSection> locker(_lock);
+
+    // Process all pending logging records
+    CombineRecords();
+
+    // Flush under the combiner lock
+    Processor::Flush();
+}
+
+} // namespace CppLogging
@@ -8,6 +8,10 @@
 
 #include "logging/record.h"
 
+#include "logging/layout.h"
+
+#include <atomic>
+
 namespace {
 
 std::string RestoreFormatString(std::string_view pattern, const std::vector<uint8_t>& buffer, size_t& offset, size_t size);
@@ -273,4 +277,17 @@ std::string Record::RestoreFormat(std::string_view pattern, const std::vector<ui
     return RestoreFormatString(pattern, buffer, index, size);
 }
 
+uint64_t Record::NextGeneration() noexcept
+{
+    static std::atomic<uint64_t> generation(0);
+    return ++generation;
+}
+
+void Record::RelayoutRecord(uint64_t file_generation)
+{
+    // Lay out the record content once again for the new logging file
+    generation = file_generation;
+    layout->LayoutRecord(*this);
+}
+
 } // namespace CppLogging
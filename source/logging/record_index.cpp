@@ -0,0 +1,203 @@
+/*!
+    \file record_index.cpp
+    \brief Logging records index implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/record_index.h"
+
+#include "logging/layouts/hash64_layout.h"
+
+#include "errors/fatal.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace CppLogging {
+
+RecordIndex::RecordIndex(size_t records, size_t bytes) : _records(records), _bytes(bytes)
+{
+    assert((records > 0) && "Index block records count should be greater than zero!");
+    if (records == 0)
+        throwex CppCommon::ArgumentException("Index block records count should be greater than zero!");
+
+    assert((bytes > 0) && "Index block size should be greater than zero!");
+    if (bytes == 0)
+        throwex CppCommon::ArgumentException("Index block size should be greater than zero!");
+}
+
+RecordIndex::~RecordIndex()
+{
+    Close();
+}
+
+void RecordIndex::Open(const CppCommon::Path& file, uint64_t offset, bool truncate)
+{
+    Close();
+
+    try
+    {
+        _index = IndexPath(file);
+
+        // Validate the existing index file to append new entries
+        if (!truncate && (offset > 0) && _index.IsFileExists())
+        {
+            uint8_t magic[HEADER_SIZE];
+            _index.Open(true, false);
+            bool valid = (_index.Read(magic, sizeof(magic)) == sizeof(magic)) && (std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0);
+            _index.Close();
+            truncate = !valid;
+        }
+        else
+            truncate = true;
+
+        // Open the index file and write its header
+        _index.OpenOrCreate(false, true, truncate);
+        if (truncate)
+            _index.Write(MAGIC, sizeof(MAGIC));
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        // Disable the index in case of any IO error
+        Close();
+    }
+
+    _entry = Entry();
+    _entry.offset = offset;
+}
+
+void RecordIndex::Close()
+{
+    try
+    {
+        // Write the last incompleted block
+        if (_index.IsFileWriteOpened())
+            WriteEntry();
+    }
+    catch (const CppCommon::FileSystemException&) {}
+
+    try
+    {
+        if (_index)
+            _index.Close();
+    }
+    catch (const CppCommon::FileSystemException&) {}
+}
+
+void RecordIndex::Update(const Record& record, size_t size)
+{
+    if (!IsOpened())
+        return;
+
+    // Update the current block
+    if (_entry.records == 0)
+        _entry.timestamp = _entry.first = _entry.last = record.timestamp;
+    else
+    {
+        _entry.first = std::min(_entry.first, record.timestamp);
+        _entry.last = std::max(_entry.last, record.timestamp);
+    }
+    _entry.size += (uint32_t)size;
+    _entry.records += 1;
+    _entry.levels |= LevelBits(record.level);
+
+    // Logging records of the same logger usually go in a row
+    if ((_entry.records == 1) || (record.logger != _logger))
+    {
+        _logger = record.logger;
+        _logger_bits = LoggerBits(_logger);
+    }
+    _entry.loggers |= _logger_bits;
+
+    // Write the completed block
+    if ((_entry.records >= _records) || (_entry.size >= _bytes))
+    {
+        try
+        {
+            WriteEntry();
+        }
+        catch (const CppCommon::FileSystemException&)
+        {
+            // Disable the index in case of any IO error
+            Close();
+        }
+    }
+}
+
+void RecordIndex::WriteEntry()
+{
+    if (_entry.records == 0)
+        return;
+
+    uint8_t buffer[ENTRY_SIZE];
+    std::memcpy(buffer, &_entry.timestamp, sizeof(uint64_t));
+    std::memcpy(buffer + 8, &_entry.first, sizeof(uint64_t));
+    std::memcpy(buffer + 16, &_entry.last, sizeof(uint64_t));
+    std::memcpy(buffer + 24, &_entry.offset, sizeof(uint64_t));
+    std::memcpy(buffer + 32, &_entry.size, sizeof(uint32_t));
+    std::memcpy(buffer + 36, &_entry.records, sizeof(uint32_t));
+    std::memcpy(buffer + 40, &_entry.levels, sizeof(uint32_t));
+    std::memcpy(buffer + 44, &_entry.loggers, sizeof(uint64_t));
+    _index.Write(buffer, sizeof(buffer));
+
+    // Start the next block
+    uint64_t offset = _entry.offset + _entry.size;
+    _entry = Entry();
+    _entry.offset = offset;
+}
+
+bool RecordIndex::Read(const CppCommon::Path& file, std::vector<Entry>& entries)
+{
+    entries.clear();
+
+    try
+    {
+        CppCommon::File index(IndexPath(file));
+        if (!index.IsFileExists())
+            return false;
+
+        // Read the whole index file
+        std::vector<uint8_t> buffer = CppCommon::File::ReadAllBytes(index);
+        size_t size = buffer.size();
+        if ((size < HEADER_SIZE) || (std::memcmp(buffer.data(), MAGIC, sizeof(MAGIC)) != 0))
+            return false;
+
+        // Parse index entries until the torn tail
+        uint64_t limit = CppCommon::File(file).size();
+        for (size_t offset = HEADER_SIZE; (size - offset) >= ENTRY_SIZE; offset += ENTRY_SIZE)
+        {
+            const uint8_t* data = buffer.data() + offset;
+            Entry entry;
+            std::memcpy(&entry.timestamp, data, sizeof(uint64_t));
+            std::memcpy(&entry.first, data + 8, sizeof(uint64_t));
+            std::memcpy(&entry.last, data + 16, sizeof(uint64_t));
+            std::memcpy(&entry.offset, data + 24, sizeof(uint64_t));
+            std::memcpy(&entry.size, data + 32, sizeof(uint32_t));
+            std::memcpy(&entry.records, data + 36, sizeof(uint32_t));
+            std::memcpy(&entry.levels, data + 40, sizeof(uint32_t));
+            std::memcpy(&entry.loggers, data + 44, sizeof(uint64_t));
+
+            // Skip entries of blocks which were not flushed into the logging file
+            if ((entry.offset + entry.size) <= limit)
+                entries.push_back(entry);
+        }
+        return true;
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        entries.clear();
+        return false;
+    }
+}
+
+uint64_t RecordIndex::LoggerBits(std::string_view logger) noexcept
+{
+    // Set two bits of the bloom filter from the logger name hash
+    uint64_t hash = Hash64Layout::Hash(logger);
+    return (1ull << (hash & 63)) | (1ull << ((hash >> 6) & 63));
+}
+
+} // namespace CppLogging
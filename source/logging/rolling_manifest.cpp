@@ -0,0 +1,350 @@
+/*!
+    \file rolling_manifest.cpp
+    \brief Rolling manifest implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/rolling_manifest.h"
+
+#include "filesystem/file.h"
+#include "threads/locker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace CppLogging {
+
+//! @cond INTERNALS
+namespace {
+
+// Manifest entry types
+enum class EntryType : uint8_t
+{
+    FILE   = 1,
+    RENAME = 2,
+    REMOVE = 3
+};
+
+// Size of the file entry without its filename
+constexpr size_t FILE_ENTRY_SIZE = 1 + 1 + 9 * sizeof(uint64_t);
+
+void WriteValue(std::vector<uint8_t>& buffer, const void* value, size_t size)
+{
+    const uint8_t* data = (const uint8_t*)value;
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+void WriteString(std::vector<uint8_t>& buffer, const std::string& value)
+{
+    uint16_t length = (uint16_t)std::min(value.size(), (size_t)0xFFFF);
+    WriteValue(buffer, &length, sizeof(uint16_t));
+    WriteValue(buffer, value.data(), length);
+}
+
+std::vector<uint8_t> PrepareEntry(EntryType type, size_t size)
+{
+    std::vector<uint8_t> buffer;
+    buffer.reserve(sizeof(uint32_t) + 1 + size);
+    buffer.resize(sizeof(uint32_t));
+    buffer.push_back((uint8_t)type);
+    return buffer;
+}
+
+void WriteSize(std::vector<uint8_t>& buffer)
+{
+    uint32_t size = (uint32_t)(buffer.size() - sizeof(uint32_t));
+    std::memcpy(buffer.data(), &size, sizeof(uint32_t));
+}
+
+bool ReadString(const uint8_t*& data, const uint8_t* end, std::string& value)
+{
+    uint16_t length;
+    if ((size_t)(end - data) < sizeof(uint16_t))
+        return false;
+    std::memcpy(&length, data, sizeof(uint16_t));
+    data += sizeof(uint16_t);
+    if ((size_t)(end - data) < length)
+        return false;
+    value.assign((const char*)data, length);
+    data += length;
+    return true;
+}
+
+// Apply the manifest entry content to the map of current logging files
+void Apply(const uint8_t* entry, const uint8_t* entry_end, std::map<std::string, RollingManifest::Entry>& files)
+{
+    EntryType type = (EntryType)*entry++;
+    switch (type)
+    {
+        case EntryType::FILE:
+        {
+            if ((size_t)(entry_end - entry) < (FILE_ENTRY_SIZE - 1))
+                break;
+            RollingManifest::Entry file;
+            file.state = (RollingManifest::State)*entry++;
+            uint64_t values[9];
+            std::memcpy(values, entry, sizeof(values));
+            entry += sizeof(values);
+            file.first = values[0];
+            file.last = values[1];
+            file.records = values[2];
+            file.fatal = values[3];
+            file.error = values[4];
+            file.warn = values[5];
+            file.info = values[6];
+            file.debug = values[7];
+            file.bytes = values[8];
+            if (ReadString(entry, entry_end, file.filename))
+                files[file.filename] = std::move(file);
+            break;
+        }
+        case EntryType::RENAME:
+        {
+            std::string filename, new_filename;
+            if (!ReadString(entry, entry_end, filename) || !ReadString(entry, entry_end, new_filename))
+                break;
+            auto it = files.find(filename);
+            if (it != files.end())
+            {
+                RollingManifest::Entry file = std::move(it->second);
+                files.erase(it);
+                file.filename = new_filename;
+                files[new_filename] = std::move(file);
+            }
+            else
+                files.erase(new_filename);
+            break;
+        }
+        case EntryType::REMOVE:
+        {
+            std::string filename;
+            if (ReadString(entry, entry_end, filename))
+                files.erase(filename);
+            break;
+        }
+        default:
+            // Skip unknown entries
+            break;
+    }
+}
+
+// Replay manifest entries into the map of current logging files
+bool Replay(const CppCommon::Path& path, std::map<std::string, RollingManifest::Entry>& files, uint64_t& valid, size_t& count)
+{
+    valid = 0;
+    count = 0;
+
+    std::vector<uint8_t> content;
+    try
+    {
+        if (!CppCommon::File(path).IsFileExists())
+            return false;
+        content = CppCommon::File::ReadAllBytes(path);
+    }
+    catch (const CppCommon::FileSystemException&)
+    {
+        return false;
+    }
+
+    if ((content.size() < sizeof(RollingManifest::MAGIC)) || (std::memcmp(content.data(), RollingManifest::MAGIC, sizeof(RollingManifest::MAGIC)) != 0))
+        return false;
+
+    // Parse manifest entries until the torn tail
+    const uint8_t* data = content.data() + sizeof(RollingManifest::MAGIC);
+    const uint8_t* end = content.data() + content.size();
+    while ((size_t)(end - data) > sizeof(uint32_t))
+    {
+        uint32_t size;
+        std::memcpy(&size, data, sizeof(uint32_t));
+        if (((size_t)(end - data - sizeof(uint32_t)) < size) || (size == 0))
+            break;
+
+        const uint8_t* entry = data + sizeof(uint32_t);
+        data = entry + size;
+        Apply(entry, data, files);
+        ++count;
+    }
+
+    // Offset of the last valid entry end
+    valid = (uint64_t)(data - content.data());
+    return true;
+}
+
+std::vector<uint8_t> PrepareFileEntry(const RollingManifest::Entry& entry)
+{
+    std::vector<uint8_t> buffer = PrepareEntry(EntryType::FILE, FILE_ENTRY_SIZE + sizeof(uint16_t) + entry.filename.size());
+    buffer.push_back((uint8_t)entry.state);
+    const uint64_t values[9] = { entry.first, entry.last, entry.records, entry.fatal, entry.error, entry.warn, entry.info, entry.debug, entry.bytes };
+    WriteValue(buffer, values, sizeof(values));
+    WriteString(buffer, entry.filename);
+    WriteSize(buffer);
+    return buffer;
+}
+
+} // namespace
+//! @endcond
+
+void RollingManifest::Entry::Update(const Record& record, size_t size) noexcept
+{
+    if ((records == 0) || (record.timestamp < first))
+        first = record.timestamp;
+    if ((records == 0) || (record.timestamp > last))
+        last = record.timestamp;
+    ++records;
+    bytes += size;
+
+    if (record.level <= Level::FATAL)
+        ++fatal;
+    else if (record.level <= Level::ERROR)
+        ++error;
+    else if (record.level <= Level::WARN)
+        ++warn;
+    else if (record.level <= Level::INFO)
+        ++info;
+    else if (record.level <= Level::DEBUG)
+        ++debug;
+}
+
+uint64_t RollingManifest::Entry::count(Level level) const noexcept
+{
+    // Level buckets are counted if any of their levels may match
+    if (level > Level::DEBUG)
+        return records;
+
+    uint64_t result = 0;
+    if (level > Level::NONE)
+        result += fatal;
+    if (level > Level::FATAL)
+        result += error;
+    if (level > Level::ERROR)
+        result += warn;
+    if (level > Level::WARN)
+        result += info;
+    if (level > Level::INFO)
+        result += debug;
+    return result;
+}
+
+RollingManifest::RollingManifest(const CppCommon::Path& path) : _path(path / FILENAME)
+{
+}
+
+void RollingManifest::Append(const Entry& entry)
+{
+    Write(PrepareFileEntry(entry));
+}
+
+void RollingManifest::Rename(const std::string& filename, const std::string& new_filename)
+{
+    std::vector<uint8_t> buffer = PrepareEntry(EntryType::RENAME, 2 * sizeof(uint16_t) + filename.size() + new_filename.size());
+    WriteString(buffer, filename);
+    WriteString(buffer, new_filename);
+    WriteSize(buffer);
+    Write(buffer);
+}
+
+void RollingManifest::Remove(const std::string& filename)
+{
+    std::vector<uint8_t> buffer = PrepareEntry(EntryType::REMOVE, sizeof(uint16_t) + filename.size());
+    WriteString(buffer, filename);
+    WriteSize(buffer);
+    Write(buffer);
+}
+
+bool RollingManifest::Find(const std::string& filename, Entry& entry)
+{
+    CppCommon::Locker<CppCommon::CriticalSection> locker(_lock);
+
+    Load();
+
+    auto it = _files.find(filename);
+    if (it == _files.end())
+        return false;
+
+    entry = it->second;
+    return true;
+}
+
+bool RollingManifest::Read(const CppCommon::Path& path, std::vector<Entry>& entries)
+{
+    entries.clear();
+
+    std::map<std::string, Entry> files;
+    uint64_t valid;
+    size_t count;
+    if (!Replay(path / FILENAME, files, valid, count))
+        return false;
+
+    for (auto& file : files)
+        entries.emplace_back(std::move(file.second));
+
+    // Logging files with unknown statistics are placed at the end
+    auto key = [](const Entry& entry) { return entry.IsKnown() ? entry.first : std::numeric_limits<uint64_t>::max(); };
+    std::stable_sort(entries.begin(), entries.end(), [&key](const Entry& a, const Entry& b) { return key(a) < key(b); });
+    return true;
+}
+
+void RollingManifest::Load()
+{
+    if (_loaded)
+        return;
+
+    // Replay the manifest file once, later entries are applied in memory
+    _files.clear();
+    Replay(_path, _files, _size, _entries);
+    _loaded = true;
+}
+
+void RollingManifest::Write(const std::vector<uint8_t>& buffer)
+{
+    CppCommon::Locker<CppCommon::CriticalSection> locker(_lock);
+
+    Load();
+
+    // Open, append and close the manifest file, so it is always consistent for readers
+    CppCommon::File manifest(_path);
+    manifest.OpenOrCreate(false, true, false);
+    // Cut the torn tail or the corrupted manifest before the first append
+    if (manifest.size() != _size)
+        manifest.Resize(_size);
+    if (_size == 0)
+    {
+        manifest.Write(MAGIC, sizeof(MAGIC));
+        _size = sizeof(MAGIC);
+    }
+    manifest.Seek(_size);
+    manifest.Write(buffer.data(), buffer.size());
+    manifest.Close();
+
+    _size += buffer.size();
+    ++_entries;
+    Apply(buffer.data() + sizeof(uint32_t), buffer.data() + buffer.size(), _files);
+
+    // Compact the manifest when most of its entries are obsolete
+    if (_entries > std::max(COMPACT_ENTRIES, 2 * _files.size()))
+        Compact();
+}
+
+void RollingManifest::Compact()
+{
+    // Write entries of current logging files into the temporary manifest file
+    std::vector<uint8_t> content(MAGIC, MAGIC + sizeof(MAGIC));
+    for (const auto& file : _files)
+    {
+        std::vector<uint8_t> buffer = PrepareFileEntry(file.second);
+        content.insert(content.end(), buffer.begin(), buffer.end());
+    }
+    CppCommon::Path temp = _path + ".tmp";
+    CppCommon::File::WriteAllBytes(temp, content.data(), content.size());
+
+    // Replace the manifest file atomically, so readers always see the consistent one
+    CppCommon::Path::Rename(temp, _path);
+
+    _size = content.size();
+    _entries = _files.size();
+}
+
+} // namespace CppLogging
@@ -0,0 +1,207 @@
+/*!
+    \file shared_file.cpp
+    \brief Shared file implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/shared_file.h"
+
+#include "errors/exceptions.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CppLogging {
+
+uint64_t SharedFile::size() const
+{
+#if defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER result;
+    if (!GetFileSizeEx((HANDLE)_file, &result))
+        throwex CppCommon::FileSystemException("Cannot get the current shared file size!").Attach(_path);
+    return (uint64_t)result.QuadPart;
+#else
+    struct stat st;
+    if (fstat(_file, &st) != 0)
+        throwex CppCommon::FileSystemException("Cannot get the current shared file size!").Attach(_path);
+    return (uint64_t)st.st_size;
+#endif
+}
+
+bool SharedFile::IsOpened() const noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return (_file != nullptr);
+#else
+    return (_file >= 0);
+#endif
+}
+
+bool SharedFile::IsReplaced() const
+{
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileW(_path.wstring().c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return true;
+    BY_HANDLE_FILE_INFORMATION current;
+    BY_HANDLE_FILE_INFORMATION opened;
+    bool result = !GetFileInformationByHandle(file, &current) || !GetFileInformationByHandle((HANDLE)_file, &opened) ||
+        (current.dwVolumeSerialNumber != opened.dwVolumeSerialNumber) || (current.nFileIndexHigh != opened.nFileIndexHigh) || (current.nFileIndexLow != opened.nFileIndexLow);
+    CloseHandle(file);
+    return result;
+#else
+    struct stat current;
+    struct stat opened;
+    if ((stat(_path.string().c_str(), &current) != 0) || (fstat(_file, &opened) != 0))
+        return true;
+    return (current.st_dev != opened.st_dev) || (current.st_ino != opened.st_ino);
+#endif
+}
+
+void SharedFile::Open(const CppCommon::Path& path)
+{
+    Close();
+
+    _path = path;
+
+    // Open the lock file which is never renamed
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE lock = CreateFileW(LockPath(path).wstring().c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (lock == INVALID_HANDLE_VALUE)
+        throwex CppCommon::FileSystemException("Cannot open the lock file of the shared file!").Attach(LockPath(path));
+    _lock = lock;
+#else
+    int lock = open(LockPath(path).string().c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (lock < 0)
+        throwex CppCommon::FileSystemException("Cannot open the lock file of the shared file!").Attach(LockPath(path));
+    _lock = lock;
+#endif
+
+    try
+    {
+        OpenFile();
+    }
+    catch (...)
+    {
+        Close();
+        throw;
+    }
+}
+
+void SharedFile::Reopen()
+{
+    CloseFile();
+    OpenFile();
+}
+
+void SharedFile::Close()
+{
+    CloseFile();
+
+#if defined(_WIN32) || defined(_WIN64)
+    if (_lock != nullptr)
+    {
+        CloseHandle((HANDLE)_lock);
+        _lock = nullptr;
+    }
+#else
+    if (_lock >= 0)
+    {
+        close(_lock);
+        _lock = -1;
+    }
+#endif
+}
+
+void SharedFile::Write(const void* buffer, size_t size)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    // Writes of the file opened only with FILE_APPEND_DATA access are always appended to the end of the file
+    DWORD written;
+    if (!WriteFile((HANDLE)_file, buffer, (DWORD)size, &written, nullptr) || (written != size))
+        throwex CppCommon::FileSystemException("Cannot write into the shared file!").Attach(_path);
+#else
+    // Regular files never perform partial writes, so the loop continues only after interrupted or failed writes
+    const uint8_t* data = (const uint8_t*)buffer;
+    while (size > 0)
+    {
+        ssize_t written = write(_file, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throwex CppCommon::FileSystemException("Cannot write into the shared file!").Attach(_path);
+        }
+        data += written;
+        size -= (size_t)written;
+    }
+#endif
+}
+
+void SharedFile::Lock(bool exclusive)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    OVERLAPPED overlapped = {};
+    if (!LockFileEx((HANDLE)_lock, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, MAXDWORD, MAXDWORD, &overlapped))
+        throwex CppCommon::FileSystemException("Cannot lock the lock file of the shared file!").Attach(LockPath(_path));
+#else
+    while (flock(_lock, exclusive ? LOCK_EX : LOCK_SH) != 0)
+        if (errno != EINTR)
+            throwex CppCommon::FileSystemException("Cannot lock the lock file of the shared file!").Attach(LockPath(_path));
+#endif
+}
+
+void SharedFile::Unlock() noexcept
+{
+    // Lock is released anyway when the lock file is closed
+#if defined(_WIN32) || defined(_WIN64)
+    OVERLAPPED overlapped = {};
+    UnlockFileEx((HANDLE)_lock, 0, MAXDWORD, MAXDWORD, &overlapped);
+#else
+    flock(_lock, LOCK_UN);
+#endif
+}
+
+void SharedFile::OpenFile()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    // Other processes should be able to rename the opened file on rolls
+    HANDLE file = CreateFileW(_path.wstring().c_str(), FILE_APPEND_DATA | SYNCHRONIZE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throwex CppCommon::FileSystemException("Cannot open the shared file!").Attach(_path);
+    _file = file;
+#else
+    int file = open(_path.string().c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (file < 0)
+        throwex CppCommon::FileSystemException("Cannot open the shared file!").Attach(_path);
+    _file = file;
+#endif
+}
+
+void SharedFile::CloseFile()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (_file != nullptr)
+    {
+        CloseHandle((HANDLE)_file);
+        _file = nullptr;
+    }
+#else
+    if (_file >= 0)
+    {
+        close(_file);
+        _file = -1;
+    }
+#endif
+}
+
+} // namespace CppLogging
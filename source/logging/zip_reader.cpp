@@ -0,0 +1,171 @@
+/*!
+    \file zip_reader.cpp
+    \brief Zip archive reader implementation
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/zip_reader.h"
+
+#include "errors/exceptions.h"
+#include "threads/thread.h"
+#include "utility/countof.h"
+#include "utility/resource.h"
+
+#include "appenders/minizip/unzip.h"
+#if defined(_WIN32) || defined(_WIN64)
+#include "appenders/minizip/iowin32.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppLogging {
+
+ZipReader::ZipReader(const CppCommon::Path& path) : _path(path)
+{
+    // Open a zip archive
+#if defined(_WIN32) || defined(_WIN64)
+    zlib_filefunc64_def ffunc;
+    fill_win32_filefunc64W(&ffunc);
+    _unzf = unzOpen2_64(path.wstring().c_str(), &ffunc);
+#else
+    _unzf = unzOpen64(path.string().c_str());
+#endif
+    if (_unzf == nullptr)
+        throwex CppCommon::FileSystemException("Cannot open a zip archive!").Attach(path);
+
+    // Start the read-ahead thread to inflate the zip archive while the previous data is decoded
+    _thread = CppCommon::Thread::Start([this]() { ReadAheadThread(); });
+}
+
+ZipReader::~ZipReader()
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    _thread.join();
+    unzClose((unzFile)_unzf);
+}
+
+size_t ZipReader::Read(void* buffer, size_t size)
+{
+    size_t result = 0;
+    while (result < size)
+    {
+        // Take the next inflated buffer
+        if (_offset == _current.size())
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this]() { return !_buffers.empty() || _eof; });
+            if (_buffers.empty())
+            {
+                if (_error)
+                    std::rethrow_exception(_error);
+                break;
+            }
+            _current = std::move(_buffers.front());
+            _buffers.pop_front();
+            _offset = 0;
+            lock.unlock();
+            _cv.notify_all();
+        }
+
+        size_t count = std::min(size - result, _current.size() - _offset);
+        std::memcpy((uint8_t*)buffer + result, _current.data() + _offset, count);
+        _offset += count;
+        result += count;
+    }
+    return result;
+}
+
+void ZipReader::ReadAheadThread()
+{
+    unzFile unzf = (unzFile)_unzf;
+
+    try
+    {
+        // Get info about the zip archive
+        unz_global_info global_info;
+        int result = unzGetGlobalInfo(unzf, &global_info);
+        if (result != UNZ_OK)
+            throwex CppCommon::FileSystemException("Cannot read a zip archive global info!").Attach(_path);
+
+        // Loop to read all files from the zip archive
+        for (uLong i = 0; i < global_info.number_entry; ++i)
+        {
+            // Go to the next file in the zip archive
+            if (i > 0)
+            {
+                result = unzGoToNextFile(unzf);
+                if (result != UNZ_OK)
+                    throwex CppCommon::FileSystemException("Cannot find the next file in the zip archive!").Attach(_path);
+            }
+
+            unz_file_info file_info;
+            char filename[1024];
+
+            // Get info about the current file in the zip archive
+            result = unzGetCurrentFileInfo(unzf, &file_info, filename, (unsigned)CppCommon::countof(filename), NULL, 0, NULL, 0);
+            if (result != UNZ_OK)
+                throwex CppCommon::FileSystemException("Cannot read a zip archive file info!").Attach(_path);
+
+            // Check if this entry is a file
+            const size_t filename_length = strlen(filename);
+            if ((filename_length > 0) && (filename[filename_length - 1] == '/'))
+                continue;
+
+            // Open the current file in the zip archive
+            result = unzOpenCurrentFile(unzf);
+            if (result != UNZ_OK)
+                throwex CppCommon::FileSystemException("Cannot open a current file in the zip archive!").Attach(_path);
+
+            // Smart resource cleaner pattern
+            auto unzip_file = CppCommon::resource(unzf, [](unzFile handle) { unzCloseCurrentFile(handle); });
+
+            // Read data from the current file in the zip archive
+            do
+            {
+                std::vector<uint8_t> buffer(BUFFER_SIZE);
+                result = unzReadCurrentFile(unzf, buffer.data(), (unsigned)buffer.size());
+                if (result < 0)
+                    throwex CppCommon::FileSystemException("Cannot read the current file from the zip archive!").Attach(_path);
+                if (result > 0)
+                {
+                    buffer.resize((size_t)result);
+
+                    // Wait for the free read-ahead buffer
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _cv.wait(lock, [this]() { return _stop || (_buffers.size() < BUFFERS); });
+                    if (_stop)
+                        return;
+                    _buffers.emplace_back(std::move(buffer));
+                    lock.unlock();
+                    _cv.notify_all();
+                }
+            } while (result != UNZ_EOF);
+
+            // Close the current file in the zip archive
+            unzip_file.release();
+            result = unzCloseCurrentFile(unzf);
+            if (result != UNZ_OK)
+                throwex CppCommon::FileSystemException("Cannot close the current file in the zip archive!").Attach(_path);
+        }
+    }
+    catch (...)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _error = std::current_exception();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _eof = true;
+    }
+    _cv.notify_all();
+}
+
+} // namespace CppLogging
@@ -4,7 +4,22 @@
 
 #include "test.h"
 
+#include "logging/appenders/compressed_file_appender.h"
 #include "logging/appenders/file_appender.h"
+#include "logging/appenders/routing_file_appender.h"
+#include "logging/appenders/striped_file_appender.h"
+
+#include "filesystem/directory.h"
+
+#include <cstring>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
 
 using namespace CppCommon;
 using namespace CppLogging;
@@ -25,3 +40,285 @@ TEST_CASE("File appender", "[CppLogging]")
     REQUIRE(file.size() == 10);
     File::Remove(file);
 }
+
+TEST_CASE("Shared file appender", "[CppLogging]")
+{
+    File file("shared.log");
+    File::RemoveIf(".", "shared(\\.[0-9]+)?\\.log(\\.lock)?");
+
+    // Several appenders with their own file handles and locks behave like several processes
+    SharedPolicy shared;
+    shared.enabled = true;
+    shared.size = 65536;
+    shared.backups = 100;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&file, &shared, i]()
+        {
+            FileAppender appender(file, false, false, true, false, shared);
+
+            Record record;
+            for (int j = 0; j < 2000; ++j)
+            {
+                std::string content = "appender" + std::to_string(i) + " record" + std::to_string(j) + std::string((size_t)(j % 64), '.') + "\n";
+                record.raw.assign(content.begin(), content.end());
+                record.raw.push_back(0);
+                appender.AppendRecord(record);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // All logging records are written into the shared file and its backups without interleaving
+    std::set<std::string> records;
+    size_t backups = 0;
+    for (const auto& entry : Directory(".").GetFiles("shared(\\.[0-9]+)?\\.log"))
+    {
+        std::vector<uint8_t> content = File::ReadAllBytes(entry);
+        if (entry.filename().string() != "shared.log")
+        {
+            REQUIRE(content.size() >= shared.size);
+            ++backups;
+        }
+
+        std::istringstream stream(std::string(content.begin(), content.end()));
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            size_t dots = line.find('.');
+            std::string name = (dots == std::string::npos) ? line : line.substr(0, dots);
+            int j = std::stoi(name.substr(name.find(" record") + 7));
+            REQUIRE(line == (name + std::string((size_t)(j % 64), '.')));
+            REQUIRE(records.insert(name).second);
+        }
+    }
+    REQUIRE(backups > 0);
+    REQUIRE(records.size() == 4 * 2000);
+
+    File::RemoveIf(".", "shared(\\.[0-9]+)?\\.log(\\.lock)?");
+}
+
+TEST_CASE("Compressed file appender", "[CppLogging]")
+{
+    File file("test.log.gz");
+    if (file.IsFileExists())
+        File::Remove(file);
+    {
+        CompressedFileAppender appender(file, false, false, true, 6, 4096);
+
+        Record record;
+        record.raw.resize(101);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            for (size_t j = 0; j < 100; ++j)
+                record.raw[j] = (uint8_t)('a' + (i + j) % 26);
+            appender.AppendRecord(record);
+
+            // Restart the appender to write the second gzip member
+            if (i == 499)
+            {
+                appender.Stop();
+                appender.Start();
+            }
+        }
+    }
+    REQUIRE(file.IsFileExists());
+    REQUIRE(file.size() > 0);
+    REQUIRE(file.size() < 1000 * 100);
+
+    // Inflate all gzip members of the file and validate its content
+    std::vector<uint8_t> compressed(file.size());
+    file.Open(true, false);
+    REQUIRE(file.Read(compressed.data(), compressed.size()) == compressed.size());
+    file.Close();
+
+    std::vector<uint8_t> content(1000 * 100 + 1);
+    z_stream stream = {};
+    REQUIRE(inflateInit2(&stream, MAX_WBITS + 16) == Z_OK);
+    stream.next_in = compressed.data();
+    stream.avail_in = (uInt)compressed.size();
+    stream.next_out = content.data();
+    stream.avail_out = (uInt)content.size();
+    int members = 0;
+    while (stream.avail_in > 0)
+    {
+        int result = inflate(&stream, Z_NO_FLUSH);
+        REQUIRE(((result == Z_OK) || (result == Z_STREAM_END)));
+        if (result == Z_STREAM_END)
+        {
+            ++members;
+            inflateReset(&stream);
+        }
+    }
+    size_t size = content.size() - stream.avail_out;
+    inflateEnd(&stream);
+
+    REQUIRE(members == 2);
+    REQUIRE(size == 1000 * 100);
+    bool valid = true;
+    for (int i = 0; i < 1000; ++i)
+        for (size_t j = 0; j < 100; ++j)
+            valid &= (content[i * 100 + j] == (uint8_t)('a' + (i + j) % 26));
+    REQUIRE(valid);
+
+    File::Remove(file);
+}
+
+namespace {
+
+// Read frames of the stripe file as sequence numbers and logging records content
+std::map<uint64_t, std::string> ReadStripe(const Path& path, uint16_t index, uint16_t count)
+{
+    std::map<uint64_t, std::string> frames;
+    std::vector<uint8_t> content = File::ReadAllBytes(path);
+    REQUIRE(content.size() >= StripedFileAppender::FILE_HEADER_SIZE);
+
+    uint16_t header_index, header_count;
+    REQUIRE(StripedFileAppender::ParseFileHeader(content.data(), header_index, header_count));
+    REQUIRE(header_index == index);
+    REQUIRE(header_count == count);
+
+    uint64_t last = 0;
+    size_t offset = StripedFileAppender::FILE_HEADER_SIZE;
+    while (offset < content.size())
+    {
+        REQUIRE((content.size() - offset) >= StripedFileAppender::FRAME_HEADER_SIZE);
+        uint64_t sequence;
+        uint32_t size;
+        std::memcpy(&sequence, content.data() + offset, sizeof(uint64_t));
+        std::memcpy(&size, content.data() + offset + sizeof(uint64_t), sizeof(uint32_t));
+        offset += StripedFileAppender::FRAME_HEADER_SIZE;
+        REQUIRE((content.size() - offset) >= size);
+
+        // Sequence numbers are ascending in each stripe
+        REQUIRE(((frames.empty()) || (sequence > last)));
+        last = sequence;
+        frames[sequence] = std::string((const char*)content.data() + offset, size);
+        offset += size;
+    }
+    return frames;
+}
+
+} // namespace
+
+TEST_CASE("Striped file appender", "[CppLogging]")
+{
+    std::vector<Path> directories = { "stripe0", "stripe1", "stripe2" };
+
+    Record record;
+    auto append = [&record](StripedFileAppender& appender, int i, const std::string& logger)
+    {
+        std::string content = "record" + std::to_string(i);
+        record.logger = logger;
+        record.raw.assign(content.begin(), content.end());
+        record.raw.push_back(0);
+        appender.AppendRecord(record);
+    };
+
+    // Round-robin batches of logging records over stripes and continue sequence numbers after restart
+    {
+        StripedFileAppender appender(directories, "test.log", StripingMode::ROUND_ROBIN, 4, true);
+        REQUIRE(appender.stripes() == 3);
+        for (int i = 0; i < 100; ++i)
+            append(appender, i, "");
+        appender.Flush();
+    }
+    {
+        StripedFileAppender appender(directories, "test.log", StripingMode::ROUND_ROBIN, 4, false);
+        REQUIRE(appender.sequence() == 100);
+        for (int i = 100; i < 110; ++i)
+            append(appender, i, "");
+    }
+
+    std::map<uint64_t, std::string> merged;
+    for (size_t i = 0; i < directories.size(); ++i)
+    {
+        auto frames = ReadStripe(directories[i] / "test.log", (uint16_t)i, 3);
+        REQUIRE(!frames.empty());
+        merged.insert(frames.begin(), frames.end());
+    }
+    REQUIRE(merged.size() == 110);
+    for (const auto& frame : merged)
+        REQUIRE(frame.second == ("record" + std::to_string(frame.first)));
+
+    // Logging records of the same logger are written into the same stripe
+    {
+        StripedFileAppender appender(directories, "test.log", StripingMode::LOGGER, 4, true);
+        for (int i = 0; i < 60; ++i)
+            append(appender, i, "logger" + std::to_string(i % 5));
+    }
+
+    std::map<uint64_t, size_t> loggers;
+    for (size_t i = 0; i < directories.size(); ++i)
+    {
+        for (const auto& frame : ReadStripe(directories[i] / "test.log", (uint16_t)i, 3))
+        {
+            auto it = loggers.emplace(frame.first % 5, i).first;
+            REQUIRE(it->second == i);
+        }
+    }
+    REQUIRE(loggers.size() == 5);
+
+    // Foreign files and stripe files of another stripes count are renamed aside instead of being truncated
+    File::WriteAllText(directories[2] / "test.log", "foreign");
+    {
+        StripedFileAppender appender(std::vector<Path>(directories.begin(), directories.begin() + 2), "test.log", StripingMode::ROUND_ROBIN, 4, false);
+        for (int i = 0; i < 8; ++i)
+            append(appender, i, "");
+    }
+    {
+        StripedFileAppender appender(directories, "test.log", StripingMode::ROUND_ROBIN, 4, false);
+        for (int i = 0; i < 12; ++i)
+            append(appender, i, "");
+    }
+
+    for (size_t i = 0; i < directories.size(); ++i)
+    {
+        REQUIRE(ReadStripe(directories[i] / "test.log", (uint16_t)i, 3).size() == 4);
+        auto backups = Directory(directories[i]).GetFiles(".*\\.bak");
+        REQUIRE(backups.size() == ((i < 2) ? 2 : 1));
+        if (i == 2)
+            REQUIRE(File::ReadAllText(backups[0]) == "foreign");
+    }
+
+    for (const auto& directory : directories)
+        Path::RemoveAll(directory);
+}
+
+TEST_CASE("Routing file appender", "[CppLogging]")
+{
+    Path path("routing");
+    Path::RemoveAll(path);
+
+    // 2026-10-18T12:00:00Z and 2026-10-19T12:00:00Z
+    const uint64_t day1 = 1792324800ull * 1000000000ull;
+    const uint64_t day2 = day1 + 86400ull * 1000000000ull;
+    const std::vector<std::string> loggers = { "tenant1", "tenant2", "tenant3", "", "../tenant4" };
+
+    {
+        // Route logging records of five loggers with only two opened files
+        RoutingFileAppender appender(path, "{Logger}/{UtcDate}.log", 2);
+
+        Record record;
+        record.raw.resize(11);
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            record.logger = loggers[i % loggers.size()];
+            record.timestamp = ((i < 500) ? day1 : day2) + i;
+            appender.AppendRecord(record);
+            REQUIRE(appender.files() <= 2);
+        }
+    }
+
+    for (const auto& logger : { "tenant1", "tenant2", "tenant3", "default", ".._tenant4" })
+    {
+        REQUIRE(File(path / logger / "2026-10-18.log").size() == 100 * 10);
+        REQUIRE(File(path / logger / "2026-10-19.log").size() == 100 * 10);
+    }
+
+    Path::RemoveAll(path);
+}
@@ -0,0 +1,190 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/appenders/block_file_appender.h"
+
+#include <cstring>
+
+#include <zlib.h>
+
+using namespace CppCommon;
+using namespace CppLogging;
+
+TEST_CASE("Block file appender", "[CppLogging]")
+{
+    File file("test.blk");
+    {
+        BlockFileAppender appender(file, true, 1000);
+
+        Record record;
+        record.raw.resize(101);
+        for (int i = 0; i < 100; ++i)
+        {
+            record.timestamp = 1000 + i;
+            appender.AppendRecord(record);
+        }
+    }
+    REQUIRE(file.IsFileExists());
+
+    // Read the block index from the trailer
+    std::vector<BlockFileAppender::BlockIndex> index;
+    {
+        File reader(file);
+        reader.Open(true, false);
+        REQUIRE(BlockFileAppender::ReadIndex(reader, index) > 0);
+    }
+    REQUIRE(index.size() == 10);
+    REQUIRE(index[0].first == 1000);
+    REQUIRE(index[0].last == 1009);
+    REQUIRE(index[9].first == 1090);
+    REQUIRE(index[9].last == 1099);
+
+    // Append blocks into the existing block file
+    {
+        BlockFileAppender appender(file, false, 1000);
+
+        Record record;
+        record.raw.resize(101);
+        record.timestamp = 2000;
+        appender.AppendRecord(record);
+    }
+    {
+        File reader(file);
+        reader.Open(true, false);
+        REQUIRE(BlockFileAppender::ReadIndex(reader, index) > 0);
+    }
+    REQUIRE(index.size() == 11);
+    REQUIRE(index[10].first == 2000);
+
+    // Corrupted block index count should be restored by scanning block headers
+    {
+        std::vector<uint8_t> content = File::ReadAllBytes(file);
+        uint64_t offset;
+        std::memcpy(&offset, content.data() + content.size() - BlockFileAppender::TRAILER_SIZE + 4, sizeof(uint64_t));
+        uint32_t count = 0xFFFFFFFF;
+        std::memcpy(content.data() + offset + 4, &count, sizeof(uint32_t));
+        File::WriteAllBytes(file, content.data(), content.size());
+
+        File reader(file);
+        reader.Open(true, false);
+        REQUIRE(BlockFileAppender::ReadIndex(reader, index) > 0);
+    }
+    REQUIRE(index.size() == 11);
+    REQUIRE(index[10].first == 2000);
+
+    File::Remove(file);
+}
+
+TEST_CASE("Block file appender with columns encoding", "[CppLogging]")
+{
+    File file("test.blk");
+    {
+        BlockFileAppender appender(file, true, 65536, 6, BlockEncoding::COLUMNS);
+
+        Record record;
+        for (int i = 0; i < 100; ++i)
+        {
+            record.timestamp = 1000 + i * 10 + (i % 3);
+            record.thread = 10 + (i % 2);
+            record.level = (i < 50) ? Level::INFO : Level::ERROR;
+            record.logger = (i % 2) ? "odd" : "even";
+            record.message = "Record {}";
+            record.buffer.assign(i % 5, (uint8_t)i);
+            appender.AppendRecord(record);
+        }
+    }
+
+    // Read the block index and the block encoding
+    std::vector<BlockFileAppender::BlockIndex> index;
+    BlockEncoding encoding = BlockEncoding::ROWS;
+    File reader(file);
+    reader.Open(true, false);
+    REQUIRE(BlockFileAppender::ReadIndex(reader, index, &encoding) > 0);
+    REQUIRE(encoding == BlockEncoding::COLUMNS);
+    REQUIRE(index.size() == 1);
+
+    // Inflate and decode the block
+    uint8_t header[BlockFileAppender::BLOCK_HEADER_SIZE];
+    reader.Seek(index[0].offset);
+    REQUIRE(reader.Read(header, sizeof(header)) == sizeof(header));
+    uint32_t compressed, raw, count, crc;
+    uint64_t first, last;
+    REQUIRE(BlockFileAppender::ParseBlockHeader(header, compressed, raw, count, first, last, crc));
+    REQUIRE(count == 100);
+    std::vector<uint8_t> data(compressed);
+    REQUIRE(reader.Read(data.data(), data.size()) == data.size());
+    std::vector<uint8_t> block(raw);
+    uLongf size = (uLongf)raw;
+    REQUIRE(uncompress(block.data(), &size, data.data(), (uLong)data.size()) == Z_OK);
+    reader.Close();
+
+    std::vector<Record> records;
+    REQUIRE(BlockFileAppender::DecodeColumns(block.data(), block.size(), records));
+    REQUIRE(records.size() == 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(records[i].timestamp == (uint64_t)(1000 + i * 10 + (i % 3)));
+        REQUIRE(records[i].thread == (uint64_t)(10 + (i % 2)));
+        REQUIRE(records[i].level == ((i < 50) ? Level::INFO : Level::ERROR));
+        REQUIRE(records[i].logger == ((i % 2) ? "odd" : "even"));
+        REQUIRE(records[i].message == "Record {}");
+        REQUIRE(records[i].buffer.size() == (size_t)(i % 5));
+    }
+
+    // Truncated block columns should not be decoded
+    REQUIRE(!BlockFileAppender::DecodeColumns(block.data(), block.size() - 1, records));
+
+    File::Remove(file);
+}
+
+TEST_CASE("Block file appender flushes only complete or expired blocks", "[CppLogging]")
+{
+    File file("test.blk");
+    {
+        BlockFileAppender appender(file, true, 65536, 6, BlockEncoding::ROWS, true, Timespan::hours(1));
+
+        Record record;
+        record.raw.resize(101);
+
+        // Frequent flushes do not write the partial block
+        uint64_t timestamp = Timestamp::utc();
+        for (int i = 0; i < 10; ++i)
+        {
+            record.timestamp = timestamp + i;
+            appender.AppendRecord(record);
+            appender.Flush();
+        }
+        REQUIRE(appender.index().empty());
+
+        // The partial block is written when its oldest logging record is older than the maximal block age
+        record.timestamp = timestamp + Timespan::hours(1).total();
+        appender.AppendRecord(record);
+        REQUIRE(appender.index().size() == 1);
+        REQUIRE(appender.index()[0].first == timestamp);
+
+        record.timestamp = timestamp - Timespan::hours(2).total();
+        appender.AppendRecord(record);
+        REQUIRE(appender.index().size() == 1);
+        appender.Flush();
+        REQUIRE(appender.index().size() == 2);
+
+        // The partial block is written when the appender is stopped
+        record.timestamp = timestamp;
+        appender.AppendRecord(record);
+        appender.Stop();
+        REQUIRE(appender.index().size() == 3);
+    }
+
+    std::vector<BlockFileAppender::BlockIndex> index;
+    {
+        File reader(file);
+        reader.Open(true, false);
+        REQUIRE(BlockFileAppender::ReadIndex(reader, index) > 0);
+    }
+    REQUIRE(index.size() == 3);
+
+    File::Remove(file);
+}
@@ -5,6 +5,12 @@
 #include "test.h"
 
 #include "logging/appenders/rolling_file_appender.h"
+#include "logging/rolling_manifest.h"
+
+#include "string/format.h"
+#include "time/time.h"
+
+#include "../source/logging/appenders/minizip/unzip.h"
 
 using namespace CppCommon;
 using namespace CppLogging;
@@ -64,3 +70,370 @@ TEST_CASE("Rolling file appender with time-based policy", "[CppLogging]")
 
     File::RemoveIf(".", ".*.log.zip");
 }
+
+TEST_CASE("Rolling file appender with monthly policy", "[CppLogging]")
+{
+    if (Path("monthly").IsExists())
+        Path::RemoveAll("monthly");
+    {
+        RollingFileAppender appender("monthly", TimeRollingPolicy::MONTH, "{UtcDate}.log");
+
+        Record record;
+        record.raw.resize(11);
+
+        // Logging files are rolled only at the beginning of the next month
+        for (const auto& time : { UtcTime(2026, 1, 30, 12), UtcTime(2026, 1, 31, 23, 59, 59), UtcTime(2026, 2, 1), UtcTime(2026, 2, 28, 12) })
+        {
+            record.timestamp = time.utcstamp().total();
+            appender.AppendRecord(record);
+        }
+    }
+
+    REQUIRE(Directory("monthly").GetFiles(".*log").size() == 2);
+    REQUIRE(File("monthly/2026-01-30.log").size() == 20);
+    REQUIRE(File("monthly/2026-02-01.log").size() == 20);
+
+    Path::RemoveAll("monthly");
+}
+
+TEST_CASE("Rolling file appender with manifest", "[CppLogging]")
+{
+    Path path("manifest");
+    {
+        RollingOptions options;
+        options.manifest = true;
+        RollingFileAppender appender(path, "test", "log", 10, 3, false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(11);
+
+        for (int i = 0; i < 5; ++i)
+        {
+            record.timestamp = 1000 + i;
+            record.level = (i == 2) ? Level::ERROR : Level::INFO;
+            appender.AppendRecord(record);
+        }
+    }
+
+    // Read the current logging files sorted by the first timestamp
+    std::vector<RollingManifest::Entry> entries;
+    REQUIRE(RollingManifest::Read(path, entries));
+    REQUIRE(entries.size() == 4);
+    REQUIRE(entries[0].filename == "test.3.log");
+    REQUIRE(entries[1].filename == "test.2.log");
+    REQUIRE(entries[2].filename == "test.1.log");
+    REQUIRE(entries[3].filename == "test.log");
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        REQUIRE(entries[i].state == RollingManifest::State::CLOSED);
+        REQUIRE(entries[i].first == 1001 + i);
+        REQUIRE(entries[i].last == 1001 + i);
+        REQUIRE(entries[i].records == 1);
+        REQUIRE(entries[i].bytes == 10);
+    }
+
+    // Prune logging files by time range and logging level
+    REQUIRE(entries[1].error == 1);
+    REQUIRE(entries[1].Match(0, 2000, Level::ERROR));
+    REQUIRE(!entries[0].Match(0, 2000, Level::ERROR));
+    REQUIRE(!entries[0].Match(1002, 2000, Level::INFO));
+    REQUIRE(entries[3].Match(1002, 2000, Level::INFO));
+
+    Path::RemoveAll(path);
+}
+
+TEST_CASE("Rolling manifest with torn tail and compaction", "[CppLogging]")
+{
+    Path path("manifest");
+    Directory::CreateTree(path);
+    {
+        RollingManifest manifest(path);
+        RollingManifest::Entry entry;
+        entry.filename = "test.log";
+        entry.records = 1;
+        entry.bytes = 10;
+        manifest.Append(entry);
+    }
+
+    // Tear the tail of the manifest file
+    std::vector<uint8_t> content = File::ReadAllBytes(path / RollingManifest::FILENAME);
+    size_t valid = content.size();
+    content.insert(content.end(), { 0x40, 0x00, 0x00, 0x00, 0x01, 0x01 });
+    File::WriteAllBytes(path / RollingManifest::FILENAME, content.data(), content.size());
+    {
+        RollingManifest manifest(path);
+        RollingManifest::Entry entry;
+        REQUIRE(manifest.Find("test.log", entry));
+        REQUIRE(entry.records == 1);
+
+        // The torn tail is cut before the first append
+        manifest.Rename("test.log", "test.1.log");
+        REQUIRE(!manifest.Find("test.log", entry));
+        REQUIRE(manifest.Find("test.1.log", entry));
+        REQUIRE(File(manifest.path()).size() > valid);
+
+        // Obsolete entries are compacted
+        for (size_t i = 0; i < 2 * RollingManifest::COMPACT_ENTRIES; ++i)
+        {
+            entry.filename = "test.log";
+            entry.records = i;
+            manifest.Append(entry);
+        }
+        REQUIRE(File(manifest.path()).size() < 4 * valid);
+    }
+
+    std::vector<RollingManifest::Entry> entries;
+    REQUIRE(RollingManifest::Read(path, entries));
+    REQUIRE(entries.size() == 2);
+    REQUIRE(entries[0].filename == "test.1.log");
+    REQUIRE(entries[1].filename == "test.log");
+    REQUIRE(entries[1].records == 2 * RollingManifest::COMPACT_ENTRIES - 1);
+
+    Path::RemoveAll(path);
+}
+
+TEST_CASE("Rolling file appender with parallel archivation", "[CppLogging]")
+{
+    RollingFileAppender::ArchiveStats stats;
+    {
+        RollingOptions options;
+        options.archive_threads = 4;
+        RollingFileAppender appender(".", "test", "log", 3 * 1048576, 3, true, false, false, true, options);
+
+        Record record;
+        record.raw.resize(1025);
+
+        for (int i = 0; i < 4000; ++i)
+        {
+            for (size_t j = 0; j < 1024; ++j)
+                record.raw[j] = (uint8_t)((i * 7 + j * (i % 13)) % 251);
+            appender.AppendRecord(record);
+        }
+
+        appender.Stop();
+        stats = appender.archive_stats();
+    }
+
+    REQUIRE(stats.queue == 0);
+    REQUIRE(stats.archived == 2);
+    REQUIRE(stats.bytes == 4000 * 1024);
+    REQUIRE(stats.compressed > 0);
+    REQUIRE(stats.max_time >= stats.last_time);
+    REQUIRE(stats.total_time >= stats.max_time);
+
+    // Inflate the first archive which is compressed in parallel and validate its content and CRC32
+    unzFile uf = unzOpen64("test.2.log.zip");
+    REQUIRE(uf != nullptr);
+    REQUIRE(unzGoToFirstFile(uf) == UNZ_OK);
+    REQUIRE(unzOpenCurrentFile(uf) == UNZ_OK);
+    std::vector<uint8_t> content(4 * 1048576);
+    int size = unzReadCurrentFile(uf, content.data(), (unsigned)content.size());
+    REQUIRE(unzCloseCurrentFile(uf) == UNZ_OK);
+    unzClose(uf);
+
+    REQUIRE(size == 3072 * 1024);
+    bool valid = true;
+    for (int i = 0; i < 3072; ++i)
+        for (size_t j = 0; j < 1024; ++j)
+            valid &= (content[i * 1024 + j] == (uint8_t)((i * 7 + j * (i % 13)) % 251));
+    REQUIRE(valid);
+
+    File::RemoveIf(".", ".*.log.zip");
+}
+
+TEST_CASE("Rolling file appender with inline compression", "[CppLogging]")
+{
+    {
+        RollingOptions options;
+        options.compress = true;
+        RollingFileAppender appender(".", "test", "log", 1000, 3, false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(101, 'x');
+
+        for (int i = 0; i < 35; ++i)
+            appender.AppendRecord(record);
+
+        REQUIRE(appender.archive_stats().archived == 0);
+    }
+
+    REQUIRE(File("test.log.gz").IsFileExists());
+    REQUIRE(File("test.log.gz").size() > 0);
+    REQUIRE(File("test.1.log.gz").IsFileExists());
+    REQUIRE(File("test.2.log.gz").IsFileExists());
+    REQUIRE(File("test.3.log.gz").IsFileExists());
+    REQUIRE(!File("test.4.log.gz").IsFileExists());
+    REQUIRE(!File("test.1.log.gz.zip").IsFileExists());
+
+    // Each rolled file contains 10 logging records of 100 bytes
+    File file("test.1.log.gz");
+    std::vector<uint8_t> compressed(file.size());
+    file.Open(true, false);
+    REQUIRE(file.Read(compressed.data(), compressed.size()) == compressed.size());
+    file.Close();
+    std::vector<uint8_t> content(2000);
+    z_stream stream = {};
+    REQUIRE(inflateInit2(&stream, MAX_WBITS + 16) == Z_OK);
+    stream.next_in = compressed.data();
+    stream.avail_in = (uInt)compressed.size();
+    stream.next_out = content.data();
+    stream.avail_out = (uInt)content.size();
+    REQUIRE(inflate(&stream, Z_FINISH) == Z_STREAM_END);
+    REQUIRE((content.size() - stream.avail_out) == 1000);
+    inflateEnd(&stream);
+
+    File::RemoveIf(".", ".*.log.gz");
+
+    // Archivation of compressed logging files is rejected
+    RollingOptions options;
+    options.compress = true;
+    REQUIRE_THROWS_AS(RollingFileAppender(".", "test", "log", 1000, 3, true, false, false, false, options), ArgumentException);
+}
+
+TEST_CASE("Rolling file appender with sequence naming", "[CppLogging]")
+{
+    if (Path("sequence").IsExists())
+        Path::RemoveAll("sequence");
+    {
+        RollingOptions options;
+        options.sequence = true;
+        options.symlink = true;
+        RollingFileAppender appender("sequence", "test", "log", 10, 3, false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(11);
+
+        for (int i = 0; i < 10; ++i)
+            appender.AppendRecord(record);
+
+        REQUIRE(Path("sequence/test.log").IsSymlink());
+        REQUIRE(File("sequence/test.log").size() == 10);
+    }
+
+    // Old logging files are removed in background and only the current and 3 rolled logging files are kept
+    for (int i = 1; i <= 6; ++i)
+        REQUIRE(!File(format("sequence/test.{:06}.log", i)).IsFileExists());
+    for (int i = 7; i <= 10; ++i)
+        REQUIRE(File(format("sequence/test.{:06}.log", i)).IsFileExists());
+
+    // Continue the last logging file after restart
+    {
+        RollingOptions options;
+        options.sequence = true;
+        options.symlink = true;
+        RollingFileAppender appender("sequence", "test", "log", 10, 3, false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(11);
+
+        appender.AppendRecord(record);
+        appender.AppendRecord(record);
+    }
+
+    REQUIRE(File("sequence/test.000010.log").size() == 20);
+    REQUIRE(File("sequence/test.000011.log").size() == 10);
+    REQUIRE(!File("sequence/test.000007.log").IsFileExists());
+
+    Path::RemoveAll("sequence");
+}
+
+TEST_CASE("Rolling file appender with pre-opened files", "[CppLogging]")
+{
+    if (Path("preopen").IsExists())
+        Path::RemoveAll("preopen");
+    {
+        RollingOptions options;
+        options.preopen = true;
+        RollingFileAppender appender("preopen", TimeRollingPolicy::SECOND, "{UtcDateTime}.log", false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(11);
+
+        // The next logging file is not predicted after the gap of two seconds
+        uint64_t timestamp = Timestamp::utc();
+        for (uint64_t seconds : { 0, 1, 2, 5, 6 })
+        {
+            record.timestamp = timestamp + seconds * 1000000000ull;
+            appender.AppendRecord(record);
+
+            // Give the archivation thread a chance to pre-open the next file
+            Thread::Sleep(10);
+        }
+    }
+
+    // Empty pre-opened files are removed
+    auto files = Directory("preopen").GetFiles(".*log");
+    REQUIRE(files.size() == 5);
+    for (const auto& file : files)
+        REQUIRE(file.size() == 10);
+
+    Path::RemoveAll("preopen");
+}
+
+TEST_CASE("Rolling file appender with retention policy", "[CppLogging]")
+{
+    if (Path("retention").IsExists())
+        Path::RemoveAll("retention");
+    Directory::CreateTree("retention");
+    Path::Touch("retention/2000-01-01T000000Z.log");
+    Path::Touch("retention/readme.txt");
+    {
+        RollingOptions options;
+        options.retention.files = 3;
+        RollingFileAppender appender("retention", TimeRollingPolicy::SECOND, "{UtcDateTime}.log", false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(11);
+
+        uint64_t timestamp = Timestamp::utc();
+        for (uint64_t seconds = 0; seconds < 10; ++seconds)
+        {
+            record.timestamp = timestamp + seconds * 1000000000ull;
+            appender.AppendRecord(record);
+        }
+    }
+
+    // Only the current and 3 rolled logging files are kept, files out of the logging pattern are not touched
+    REQUIRE(Directory("retention").GetFiles(".*log").size() == 4);
+    REQUIRE(!File("retention/2000-01-01T000000Z.log").IsFileExists());
+    REQUIRE(File("retention/readme.txt").IsFileExists());
+
+    Path::RemoveAll("retention");
+    {
+        RollingOptions options;
+        options.sequence = true;
+        options.retention.bytes = 25;
+        RollingFileAppender appender("retention", "test", "log", 10, 100, false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(11);
+
+        for (int i = 0; i < 10; ++i)
+            appender.AppendRecord(record);
+    }
+
+    // Only the current and 2 rolled logging files fit into 25 bytes
+    for (int i = 1; i <= 7; ++i)
+        REQUIRE(!File(format("retention/test.{:06}.log", i)).IsFileExists());
+    for (int i = 8; i <= 10; ++i)
+        REQUIRE(File(format("retention/test.{:06}.log", i)).IsFileExists());
+
+    Path::RemoveAll("retention");
+    {
+        RollingOptions options;
+        options.retention.files = 1;
+        RollingFileAppender appender("retention", "test", "log", 10, 3, false, false, false, true, options);
+
+        Record record;
+        record.raw.resize(11);
+
+        for (int i = 0; i < 10; ++i)
+            appender.AppendRecord(record);
+    }
+
+    // Renamed backups are limited only by the backups count
+    REQUIRE(Directory("retention").GetFiles(".*log").size() == 4);
+    REQUIRE(File("retention/test.3.log").IsFileExists());
+
+    Path::RemoveAll("retention");
+}
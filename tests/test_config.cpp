@@ -0,0 +1,168 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/config.h"
+#include "logging/logger.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace CppLogging;
+
+namespace {
+
+class LoggerNameAppender : public Appender
+{
+public:
+    std::string logger;
+
+    void AppendRecord(Record& record) override { logger = record.logger; }
+};
+
+class CountingAppender : public Appender
+{
+public:
+    std::atomic<size_t> records{0};
+
+    bool IsStarted() const noexcept override { return _started; }
+
+    bool Start() override { _started = true; return true; }
+    bool Stop() override { _started = false; return true; }
+
+    void AppendRecord(Record& record) override { ++records; }
+
+private:
+    std::atomic<bool> _started{false};
+};
+
+} // namespace
+
+TEST_CASE("Config hierarchical logger names", "[CppLogging]")
+{
+    auto default_appender = std::make_shared<LoggerNameAppender>();
+    auto default_sink = std::make_shared<Processor>(std::make_shared<NullLayout>());
+    default_sink->appenders().push_back(default_appender);
+    Config::ConfigLogger(default_sink);
+
+    auto db_appender = std::make_shared<LoggerNameAppender>();
+    auto db_sink = std::make_shared<Processor>(std::make_shared<NullLayout>());
+    db_sink->appenders().push_back(db_appender);
+    Config::ConfigLogger("db", db_sink);
+
+    auto pool_appender = std::make_shared<LoggerNameAppender>();
+    auto pool_sink = std::make_shared<Processor>(std::make_shared<NullLayout>());
+    pool_sink->appenders().push_back(pool_appender);
+    Config::ConfigLogger("db.pool", pool_sink);
+
+    Config::Startup();
+
+    Config::CreateLogger("db.pool.conn").Info("Test");
+    REQUIRE(pool_appender->logger == "db.pool.conn");
+    REQUIRE(db_appender->logger.empty());
+
+    Config::CreateLogger("db.cache").Info("Test");
+    REQUIRE(db_appender->logger == "db.cache");
+
+    default_appender->logger = "unknown";
+    Config::CreateLogger("dbx").Info("Test");
+    REQUIRE(db_appender->logger == "db.cache");
+    REQUIRE(default_appender->logger.empty());
+
+    Config::Shutdown();
+}
+
+TEST_CASE("Config live reconfiguration", "[CppLogging]")
+{
+    auto old_appender = std::make_shared<LoggerNameAppender>();
+    auto old_sink = std::make_shared<Processor>(std::make_shared<NullLayout>());
+    old_sink->appenders().push_back(old_appender);
+    Config::ConfigLogger(old_sink);
+    Config::Startup();
+
+    Logger logger("app");
+    logger.Info("Test");
+    REQUIRE(old_appender->logger == "app");
+
+    // Swap the new logging sink while the old one is still working
+    auto new_appender = std::make_shared<LoggerNameAppender>();
+    auto new_sink = std::make_shared<Processor>(std::make_shared<NullLayout>());
+    new_sink->appenders().push_back(new_appender);
+    Config::ConfigLogger("app", new_sink);
+    Config::Startup();
+
+    old_appender->logger.clear();
+    logger.Info("Test");
+    REQUIRE(new_appender->logger == "app");
+    REQUIRE(old_appender->logger.empty());
+    REQUIRE(new_sink->IsStarted());
+
+    // Replaced logging sink is flushed and released, but never stopped
+    Config::Shutdown();
+    REQUIRE(old_sink->IsStarted());
+    REQUIRE(!new_sink->IsStarted());
+}
+
+TEST_CASE("Config live reconfiguration with shared appender", "[CppLogging]")
+{
+    auto appender = std::make_shared<CountingAppender>();
+    auto old_sink = std::make_shared<Processor>(std::make_shared<NullLayout>());
+    old_sink->appenders().push_back(appender);
+    Config::ConfigLogger(old_sink);
+    Config::Startup();
+
+    // The configuration owns the old logging sink from now
+    std::weak_ptr<Processor> old_weak = old_sink;
+    old_sink.reset();
+
+    // Producers keep logging during the swap
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> producers;
+    for (int i = 0; i < 4; ++i)
+    {
+        producers.emplace_back([&stop]()
+        {
+            Logger logger("app");
+            while (!stop)
+                logger.Info("Test");
+        });
+    }
+    while (appender->records == 0)
+        std::this_thread::yield();
+
+    // Change the logging level with the new logging sink around the same appender
+    auto new_sink = std::make_shared<Processor>(std::make_shared<NullLayout>());
+    new_sink->filters().push_back(std::make_shared<LevelFilter>(Level::WARN));
+    new_sink->appenders().push_back(appender);
+    Config::ConfigLogger(new_sink);
+    Config::Startup();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    stop = true;
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the grace period until the old logging sink is released
+    Logger logger("app");
+    auto timestamp = std::chrono::steady_clock::now();
+    while (!old_weak.expired() && ((std::chrono::steady_clock::now() - timestamp) < std::chrono::seconds(10)))
+    {
+        logger.Flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    REQUIRE(old_weak.expired());
+
+    // The shared appender is still working after the old logging sink was released
+    REQUIRE(appender->IsStarted());
+    size_t records = appender->records;
+    logger.Info("Test");
+    REQUIRE(appender->records == records);
+    logger.Warn("Test");
+    REQUIRE(appender->records == (records + 1));
+
+    Config::Shutdown();
+}
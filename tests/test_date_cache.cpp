@@ -0,0 +1,68 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/date_cache.h"
+
+#include "string/format.h"
+#include "time/time.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppLogging;
+
+namespace {
+
+std::string Format(const DateCache::DateTime& datetime)
+{
+    return std::string(datetime.year, sizeof(DateCache::DateTime));
+}
+
+std::string Format(const Time& time)
+{
+    return format("{:04}{:02}{:02}{:02}{:02}{:02}", time.year(), time.month(), time.day(), time.hour(), time.minute(), time.second());
+}
+
+} // namespace
+
+TEST_CASE("Date cache", "[CppLogging]")
+{
+    uint64_t now = Timestamp::utc() / 1000000000ull;
+
+    // Current, delayed, leap day and far seconds are rendered the same as the system time
+    for (uint64_t seconds : { now, now + 1, now - 1, now, now - 86400 * 100, (uint64_t)951782400, (uint64_t)4107542399, (uint64_t)0, now })
+    {
+        DateCache::Entry entry;
+        DateCache::Get(seconds, entry);
+        REQUIRE(entry.seconds == seconds);
+        REQUIRE(Format(entry.utc) == Format(UtcTime(Timestamp(seconds * 1000000000ull))));
+        REQUIRE(Format(entry.local) == Format(LocalTime(Timestamp(seconds * 1000000000ull))));
+    }
+
+    // Concurrent readers and publishers always get consistent entries
+    std::atomic<bool> valid{true};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&valid, now, i]()
+        {
+            for (uint64_t j = 0; j < 10000; ++j)
+            {
+                uint64_t seconds = now + (j / 10) * (i + 1);
+                DateCache::Entry entry;
+                DateCache::Get(seconds, entry);
+                if ((entry.seconds != seconds) || (Format(entry.utc) != Format(UtcTime(Timestamp(seconds * 1000000000ull)))))
+                    valid = false;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(valid);
+}
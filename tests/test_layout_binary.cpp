@@ -5,6 +5,7 @@
 #include "test.h"
 
 #include "logging/layouts/binary_layout.h"
+#include "logging/layouts/binary_layout_v2.h"
 
 #include <cstring>
 
@@ -54,6 +55,58 @@ Record ParseBinaryLayout(const std::vector<uint8_t>& raw)
     return record;
 }
 
+Record ParseBinaryLayoutV2(const std::vector<uint8_t>& raw, uint64_t& base)
+{
+    Record record;
+
+    // Get the buffer start position
+    const uint8_t* buffer = raw.data();
+    size_t size = raw.size() - 1;
+
+    // Deserialize the sync frame
+    REQUIRE(size > BinaryLayoutV2::SYNC_SIZE);
+    REQUIRE(std::memcmp(buffer, BinaryLayoutV2::MAGIC, sizeof(BinaryLayoutV2::MAGIC)) == 0);
+    REQUIRE(buffer[4] == BinaryLayoutV2::VERSION);
+    uint32_t crc;
+    std::memcpy(&crc, buffer + 14, sizeof(uint32_t));
+    REQUIRE(crc == BinaryLayoutV2::CRC32C(buffer, 14));
+    std::memcpy(&base, buffer + 6, sizeof(uint64_t));
+    buffer += BinaryLayoutV2::SYNC_SIZE;
+
+    // Deserialize the logging record frame
+    REQUIRE(*buffer++ == BinaryLayoutV2::RECORD_TAG);
+    uint64_t payload_size;
+    buffer += BinaryLayoutV2::ReadVarint(buffer, 10, payload_size);
+    std::memcpy(&crc, buffer + payload_size, sizeof(uint32_t));
+    REQUIRE(crc == BinaryLayoutV2::CRC32C(buffer, (size_t)payload_size));
+
+    uint64_t value;
+    buffer += BinaryLayoutV2::ReadVarint(buffer, 10, value);
+    record.timestamp = base + ((value >> 1) ^ -(int64_t)(value & 1));
+    buffer += BinaryLayoutV2::ReadVarint(buffer, 10, record.thread);
+    std::memcpy(&record.level, buffer, sizeof(Level));
+    buffer += sizeof(Level);
+
+    buffer += BinaryLayoutV2::ReadVarint(buffer, 10, value);
+    record.logger.insert(record.logger.begin(), buffer, buffer + value);
+    buffer += value;
+
+    buffer += BinaryLayoutV2::ReadVarint(buffer, 10, value);
+    record.message.insert(record.message.begin(), buffer, buffer + value);
+    buffer += value;
+
+    buffer += BinaryLayoutV2::ReadVarint(buffer, 10, value);
+    record.buffer.insert(record.buffer.begin(), buffer, buffer + value);
+    buffer += value;
+
+    // Skip the checksum
+    buffer += sizeof(uint32_t);
+
+    REQUIRE(buffer == raw.data() + size);
+
+    return record;
+}
+
 bool CompareRecords(const Record& record1, const Record& record2)
 {
     if (record1.timestamp != record2.timestamp)
@@ -87,3 +140,24 @@ TEST_CASE("Binary layout", "[CppLogging]")
     Record clone = ParseBinaryLayout(record.raw);
     REQUIRE(CompareRecords(clone, record));
 }
+
+TEST_CASE("Binary layout version 2", "[CppLogging]")
+{
+    REQUIRE(BinaryLayoutV2::CRC32C("123456789", 9) == 0xE3069283);
+
+    Record record;
+    record.timestamp = 1234567890123456789ull;
+    record.thread = 123;
+    record.logger = std::string(300, 'L');
+    record.message = std::string(70000, 'M');
+    record.buffer.resize(1024, 123);
+
+    BinaryLayoutV2 layout;
+    layout.LayoutRecord(record);
+    REQUIRE(record.raw.size() > 0);
+
+    uint64_t base;
+    Record clone = ParseBinaryLayoutV2(record.raw, base);
+    REQUIRE(base == record.timestamp);
+    REQUIRE(CompareRecords(clone, record));
+}
@@ -0,0 +1,254 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/appenders/rolling_file_appender.h"
+#include "logging/appenders/routing_file_appender.h"
+#include "logging/layouts/dictionary_layout.h"
+
+#include "filesystem/filesystem.h"
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace CppLogging;
+
+namespace {
+
+size_t CountEntries(const Record& record)
+{
+    size_t count = 0;
+    size_t offset = 0;
+    uint32_t size;
+    for (;;)
+    {
+        std::memcpy(&size, record.raw.data() + offset, sizeof(uint32_t));
+        if ((size & DictionaryLayout::DICTIONARY_FLAG) == 0)
+            break;
+        offset += sizeof(uint32_t) + (size & ~DictionaryLayout::DICTIONARY_FLAG);
+        ++count;
+    }
+
+    // The logging record frame should be the same as the hash layout frame
+    HashLayout layout;
+    Record hash;
+    hash.timestamp = record.timestamp;
+    hash.logger = record.logger;
+    hash.message = record.message;
+    layout.LayoutRecord(hash);
+    REQUIRE((record.raw.size() - offset) == hash.raw.size());
+    REQUIRE(std::memcmp(record.raw.data() + offset, hash.raw.data(), hash.raw.size()) == 0);
+
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Dictionary layout", "[CppLogging]")
+{
+    DictionaryLayout layout;
+
+    Record record;
+    record.timestamp = 1000000000;
+    record.logger = "test";
+    record.message = "Test message {}";
+
+    // The first logging record emits the logger name and the message entries
+    layout.LayoutRecord(record);
+    REQUIRE(CountEntries(record) == 2);
+
+    // The same logging record emits only hashes
+    layout.LayoutRecord(record);
+    REQUIRE(CountEntries(record) == 0);
+
+    // The new message emits only its entry
+    record.message = "Another message {}";
+    layout.LayoutRecord(record);
+    REQUIRE(CountEntries(record) == 1);
+
+    // The next second keeps the dictionary
+    record.timestamp = 2000000000;
+    layout.LayoutRecord(record);
+    REQUIRE(CountEntries(record) == 0);
+
+    // Explicit reset of the dictionary
+    layout.Reset();
+    layout.LayoutRecord(record);
+    REQUIRE(CountEntries(record) == 2);
+
+    // The same logging file generation keeps the logging record
+    std::vector<uint8_t> raw = record.raw;
+    record.Relayout(record.generation);
+    REQUIRE(record.raw == raw);
+
+    // The new logging file generation resets the dictionary and lays out the logging record once again
+    record.Relayout(Record::NextGeneration());
+    REQUIRE(CountEntries(record) == 2);
+    layout.LayoutRecord(record);
+    REQUIRE(CountEntries(record) == 0);
+
+    // The logger name with the same hash as the logging message emits both entries
+    record.logger = "Same string {}";
+    record.message = "Same string {}";
+    layout.LayoutRecord(record);
+    REQUIRE(CountEntries(record) == 2);
+}
+
+namespace {
+
+// Decode the dictionary hash log file on its own into logger names and logging messages of its logging records
+std::vector<std::pair<std::string, std::string>> DecodeFile(const CppCommon::Path& path)
+{
+    std::vector<std::pair<std::string, std::string>> records;
+    std::unordered_map<uint32_t, std::string> dictionary;
+    std::vector<uint8_t> content = CppCommon::File::ReadAllBytes(path);
+    size_t offset = 0;
+    while (offset < content.size())
+    {
+        REQUIRE((content.size() - offset) >= sizeof(uint32_t));
+        uint32_t size;
+        std::memcpy(&size, content.data() + offset, sizeof(uint32_t));
+        offset += sizeof(uint32_t);
+
+        uint32_t hash;
+        if ((size & DictionaryLayout::DICTIONARY_FLAG) != 0)
+        {
+            // Dictionary entry
+            size &= ~DictionaryLayout::DICTIONARY_FLAG;
+            REQUIRE((content.size() - offset) >= size);
+            std::memcpy(&hash, content.data() + offset, sizeof(uint32_t));
+            dictionary[hash] = std::string((const char*)content.data() + offset + sizeof(uint32_t), size - sizeof(uint32_t));
+        }
+        else
+        {
+            // Logging record frame with all its hashes resolved by dictionary entries of the same file
+            REQUIRE((content.size() - offset) >= size);
+            size_t hashes = offset + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(Level);
+            std::memcpy(&hash, content.data() + hashes, sizeof(uint32_t));
+            REQUIRE(dictionary.find(hash) != dictionary.end());
+            std::string logger = dictionary[hash];
+            std::memcpy(&hash, content.data() + hashes + sizeof(uint32_t), sizeof(uint32_t));
+            REQUIRE(dictionary.find(hash) != dictionary.end());
+            records.emplace_back(logger, dictionary[hash]);
+        }
+        offset += size;
+    }
+    return records;
+}
+
+} // namespace
+
+TEST_CASE("Dictionary layout with rolling file appender", "[CppLogging]")
+{
+    if (CppCommon::Path("dictionary").IsExists())
+        CppCommon::Path::RemoveAll("dictionary");
+    {
+        DictionaryLayout layout;
+        RollingFileAppender appender("dictionary", "test", "log", 1, 10);
+
+        Record record;
+        record.logger = "test";
+        record.message = "Test message {}";
+
+        // Each logging record is rolled into the separate logging file
+        for (int i = 0; i < 5; ++i)
+        {
+            layout.LayoutRecord(record);
+            appender.AppendRecord(record);
+        }
+    }
+
+    // Each logging file should start with dictionary entries it needs
+    size_t files = 0;
+    for (const auto& entry : CppCommon::Directory("dictionary").GetFiles())
+    {
+        std::vector<uint8_t> content = CppCommon::File::ReadAllBytes(entry);
+        REQUIRE(content.size() > sizeof(uint32_t));
+        uint32_t size;
+        std::memcpy(&size, content.data(), sizeof(uint32_t));
+        REQUIRE((size & DictionaryLayout::DICTIONARY_FLAG) != 0);
+        ++files;
+    }
+    REQUIRE(files == 5);
+
+    CppCommon::Path::RemoveAll("dictionary");
+}
+
+TEST_CASE("Dictionary layout with rolled logging files decoded on their own", "[CppLogging]")
+{
+    if (CppCommon::Path("dictionary").IsExists())
+        CppCommon::Path::RemoveAll("dictionary");
+    {
+        DictionaryLayout layout;
+        RollingFileAppender appender("dictionary", "test", "log", 300, 10);
+
+        Record record;
+        for (int i = 0; i < 30; ++i)
+        {
+            record.Clear();
+            record.logger = "logger" + std::to_string(i % 3);
+            record.message = "Test message " + std::to_string(i % 4);
+            layout.LayoutRecord(record);
+            appender.AppendRecord(record);
+        }
+    }
+
+    // Every rolled logging file is decoded without dictionary entries of other files
+    auto files = CppCommon::Directory("dictionary").GetFiles();
+    REQUIRE(files.size() > 2);
+    size_t records = 0;
+    for (const auto& entry : files)
+    {
+        auto decoded = DecodeFile(entry);
+        REQUIRE(!decoded.empty());
+        for (const auto& item : decoded)
+        {
+            REQUIRE(item.first.rfind("logger", 0) == 0);
+            REQUIRE(item.second.rfind("Test message ", 0) == 0);
+        }
+        records += decoded.size();
+    }
+    REQUIRE(records == 30);
+
+    CppCommon::Path::RemoveAll("dictionary");
+}
+
+TEST_CASE("Dictionary layout with routing file appender", "[CppLogging]")
+{
+    if (CppCommon::Path("dictionary").IsExists())
+        CppCommon::Path::RemoveAll("dictionary");
+    {
+        DictionaryLayout layout;
+        RoutingFileAppender appender("dictionary", "{Logger}.log");
+
+        // Interleaved loggers share logging messages, but are routed into separate logging files
+        Record record;
+        for (int i = 0; i < 30; ++i)
+        {
+            record.Clear();
+            record.logger = "logger" + std::to_string(i % 3);
+            record.message = "Test message " + std::to_string(i % 4);
+            layout.LayoutRecord(record);
+            appender.AppendRecord(record);
+        }
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        std::string logger = "logger" + std::to_string(i);
+        auto decoded = DecodeFile(CppCommon::Path("dictionary") / (logger + ".log"));
+        REQUIRE(decoded.size() == 10);
+        for (size_t j = 0; j < decoded.size(); ++j)
+        {
+            REQUIRE(decoded[j].first == logger);
+            REQUIRE(decoded[j].second == ("Test message " + std::to_string((i + j * 3) % 4)));
+        }
+    }
+
+    CppCommon::Path::RemoveAll("dictionary");
+}
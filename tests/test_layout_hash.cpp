@@ -0,0 +1,124 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/hashlog.h"
+#include "logging/layouts/hash_layout.h"
+#include "logging/layouts/hash64_layout.h"
+
+#include "filesystem/file.h"
+
+#include <cstring>
+#include <set>
+
+using namespace CppCommon;
+using namespace CppLogging;
+
+TEST_CASE("64-bit hash layout", "[CppLogging]")
+{
+    // Hashes of strings of all lengths up to the multiple blocks should be different
+    std::set<uint64_t> hashes;
+    std::string message;
+    for (int i = 0; i < 200; ++i)
+    {
+        REQUIRE(Hash64Layout::Hash(message) == Hash64Layout::Hash(std::string(message)));
+        hashes.insert(Hash64Layout::Hash(message));
+        message += (char)('a' + (i % 26));
+    }
+    REQUIRE(hashes.size() == 200);
+    REQUIRE(Hash64Layout::Hash("Test message {}") != Hash64Layout::Hash("Test message {} "));
+
+    Hash64Layout layout;
+    Record record;
+    record.logger = "test";
+    record.message = "Test message {}";
+    layout.LayoutRecord(record);
+
+    uint32_t size;
+    std::memcpy(&size, record.raw.data(), sizeof(uint32_t));
+    REQUIRE((size & Hash64Layout::HASH64_FLAG) != 0);
+    REQUIRE((size & ~Hash64Layout::HASH64_FLAG) == (record.raw.size() - sizeof(uint32_t) - 1));
+
+    uint64_t message_hash;
+    std::memcpy(&message_hash, record.raw.data() + sizeof(uint32_t) + 8 + 8 + 1 + 8, sizeof(uint64_t));
+    REQUIRE(message_hash == Hash64Layout::Hash(record.message));
+}
+
+TEST_CASE("Hash logs map", "[CppLogging]")
+{
+    Path path("test.hashlog");
+    std::string_view value;
+
+    {
+        Hashlog hashlog;
+        REQUIRE(hashlog.Insert(HashLayout::Hash("test"), "test"));
+        REQUIRE(hashlog.Insert(Hash64Layout::Hash("Test message {}"), "Test message {}"));
+        REQUIRE(hashlog.Insert(HashLayout::Hash("test"), "test"));
+        REQUIRE(!hashlog.Insert(HashLayout::Hash("test"), "collision"));
+        hashlog.Write(path);
+    }
+
+    // Read the memory-mapped hash logs map and append new entries into the journal
+    {
+        Hashlog hashlog;
+        REQUIRE(hashlog.Read(path));
+        REQUIRE(hashlog.size() == 2);
+        REQUIRE(hashlog.Find(HashLayout::Hash("test"), value));
+        REQUIRE(value == "test");
+        REQUIRE(hashlog.Find(Hash64Layout::Hash("Test message {}"), value));
+        REQUIRE(value == "Test message {}");
+        REQUIRE(!hashlog.Find(0, value));
+
+        REQUIRE(hashlog.Insert(HashLayout::Hash("journal"), "journal"));
+        hashlog.Append(path);
+        REQUIRE(hashlog.size() == 3);
+        REQUIRE(hashlog.Find(HashLayout::Hash("journal"), value));
+        REQUIRE(value == "journal");
+    }
+    {
+        Hashlog hashlog;
+        REQUIRE(hashlog.Read(path));
+        REQUIRE(hashlog.size() == 3);
+        REQUIRE(hashlog.Find(HashLayout::Hash("journal"), value));
+        REQUIRE(value == "journal");
+        REQUIRE(hashlog.Find(HashLayout::Hash("test"), value));
+        REQUIRE(value == "test");
+
+        // Compact the journal into the sorted table
+        hashlog.Write(path);
+        REQUIRE(hashlog.Find(HashLayout::Hash("journal"), value));
+        REQUIRE(value == "journal");
+    }
+    {
+        Hashlog hashlog;
+        REQUIRE(hashlog.Read(path));
+        REQUIRE(hashlog.size() == 3);
+        REQUIRE(hashlog.Find(HashLayout::Hash("journal"), value));
+        REQUIRE(value == "journal");
+    }
+
+    // Read the hash logs map version 1
+    {
+        File file(path);
+        file.OpenOrCreate(false, true, true);
+        uint32_t count = 1;
+        uint32_t hash = HashLayout::Hash("legacy");
+        uint16_t length = 6;
+        file.Write(&count, sizeof(uint32_t));
+        file.Write(&hash, sizeof(uint32_t));
+        file.Write(&length, sizeof(uint16_t));
+        file.Write("legacy", length);
+        file.Close();
+    }
+    {
+        Hashlog hashlog;
+        REQUIRE(hashlog.Read(path));
+        REQUIRE(hashlog.size() == 1);
+        REQUIRE(hashlog.Find(HashLayout::Hash("legacy"), value));
+        REQUIRE(value == "legacy");
+    }
+
+    File::Remove(path);
+}
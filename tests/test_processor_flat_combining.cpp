@@ -0,0 +1,88 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/processors/flat_combining_processor.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppLogging;
+
+namespace {
+
+class CountingAppender : public Appender
+{
+public:
+    explicit CountingAppender(size_t records) : counters(records, 0) {}
+
+    std::vector<int> counters;
+
+    void AppendRecord(Record& record) override
+    {
+        size_t index = std::stoul(record.message);
+        ++counters[index];
+
+        // Fail processing of every tenth logging record
+        if ((index % 10) == 7)
+            throw std::runtime_error("Appender failure");
+    }
+};
+
+} // namespace
+
+TEST_CASE("Flat-combining processor", "[CppLogging]")
+{
+    const size_t threads = 8;
+    const size_t records = 20000;
+
+    auto appender = std::make_shared<CountingAppender>(threads * records);
+    auto processor = std::make_shared<FlatCombiningProcessor>(nullptr, 4);
+    processor->appenders().push_back(appender);
+
+    std::atomic<size_t> processed{0};
+    std::atomic<size_t> failed{0};
+
+    std::vector<std::thread> producers;
+    for (size_t thread = 0; thread < threads; ++thread)
+    {
+        producers.emplace_back([&, thread]()
+        {
+            for (size_t i = 0; i < records; ++i)
+            {
+                size_t index = thread * records + i;
+                Record record;
+                record.message = std::to_string(index);
+                try
+                {
+                    if (processor->ProcessRecord(record))
+                        ++processed;
+                }
+                catch (const std::runtime_error&)
+                {
+                    // Only failed logging records of the current producer should be rethrown
+                    if ((index % 10) == 7)
+                        ++failed;
+                }
+            }
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    processor->Flush();
+
+    // Every logging record should be delivered exactly once
+    size_t delivered = 0;
+    for (int counter : appender->counters)
+        if (counter == 1)
+            ++delivered;
+    REQUIRE(delivered == threads * records);
+    REQUIRE(failed == threads * records / 10);
+    REQUIRE(processed == threads * records - failed);
+}
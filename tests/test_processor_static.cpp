@@ -0,0 +1,131 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/config.h"
+#include "logging/logger.h"
+#include "logging/processors/static_processor.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace CppLogging;
+
+namespace {
+
+class PrefixLayout : public Layout
+{
+public:
+    explicit PrefixLayout(const std::string& prefix) : _prefix(prefix) {}
+
+    bool IsStarted() const noexcept override { return _started; }
+
+    bool Start() override { _started = true; return true; }
+    bool Stop() override { _started = false; return true; }
+
+    void LayoutRecord(Record& record) override
+    {
+        std::string content = _prefix + (record.IsFormatStored() ? record.RestoreFormat() : record.message);
+        record.raw.assign(content.begin(), content.end());
+    }
+
+private:
+    std::string _prefix;
+    bool _started{false};
+};
+
+class RecordingAppender : public Appender
+{
+public:
+    std::vector<std::string> records;
+
+    bool IsStarted() const noexcept override { return _started; }
+
+    bool Start() override { _started = true; return true; }
+    bool Stop() override { _started = false; return true; }
+
+    void AppendRecord(Record& record) override { records.emplace_back(record.raw.begin(), record.raw.end()); }
+
+private:
+    bool _started{false};
+};
+
+typedef StaticProcessor<Filters<LevelFilter>, PrefixLayout, Appenders<RecordingAppender, RecordingAppender>> TestProcessor;
+
+std::shared_ptr<TestProcessor> CreateProcessor()
+{
+    return std::make_shared<TestProcessor>(
+        std::make_tuple(std::make_tuple(Level::WARN)),
+        std::make_tuple(std::string("static: ")),
+        std::make_tuple(std::make_tuple(), std::make_tuple()));
+}
+
+} // namespace
+
+TEST_CASE("Static processor", "[CppLogging]")
+{
+    auto processor = CreateProcessor();
+    REQUIRE(!processor->static_layout().IsStarted());
+    REQUIRE(!processor->appender<0>().IsStarted());
+    REQUIRE(!processor->appender<1>().IsStarted());
+
+    // Start static logging elements together with the processor
+    REQUIRE(processor->Start());
+    REQUIRE(processor->IsStarted());
+    REQUIRE(processor->static_layout().IsStarted());
+    REQUIRE(processor->appender<0>().IsStarted());
+    REQUIRE(processor->appender<1>().IsStarted());
+
+    Record record;
+
+    // Filter rejects the logging record
+    record.level = Level::INFO;
+    record.message = "Info";
+    REQUIRE(!processor->FilterRecord(record));
+    REQUIRE(processor->ProcessRecord(record));
+    REQUIRE(processor->appender<0>().records.empty());
+    REQUIRE(processor->appender<1>().records.empty());
+
+    // Layout the logging record and append it to all appenders
+    record.level = Level::WARN;
+    record.message = "Warn";
+    REQUIRE(processor->FilterRecord(record));
+    REQUIRE(processor->ProcessRecord(record));
+    REQUIRE(processor->appender<0>().records == std::vector<std::string>({ "static: Warn" }));
+    REQUIRE(processor->appender<1>().records == std::vector<std::string>({ "static: Warn" }));
+
+    // Stop static logging elements together with the processor
+    REQUIRE(processor->Stop());
+    REQUIRE(!processor->IsStarted());
+    REQUIRE(!processor->static_layout().IsStarted());
+    REQUIRE(!processor->appender<0>().IsStarted());
+    REQUIRE(!processor->appender<1>().IsStarted());
+
+    // Stopped processor skips logging records
+    REQUIRE(processor->ProcessRecord(record));
+    REQUIRE(processor->appender<0>().records.size() == 1);
+}
+
+TEST_CASE("Static processor as logging sink", "[CppLogging]")
+{
+    auto processor = CreateProcessor();
+    Config::ConfigLogger("static", processor);
+    Config::Startup();
+    REQUIRE(processor->IsStarted());
+    REQUIRE(processor->appender<0>().IsStarted());
+
+    Logger logger("static.child");
+    logger.Info("Info {}", 1);
+    logger.Warn("Warn {}", 2);
+    logger.Error("Error");
+    REQUIRE(processor->appender<0>().records == std::vector<std::string>({ "static: Warn 2", "static: Error" }));
+    REQUIRE(processor->appender<1>().records == processor->appender<0>().records);
+
+    Config::Shutdown();
+    REQUIRE(!processor->IsStarted());
+    REQUIRE(!processor->appender<0>().IsStarted());
+    REQUIRE(!processor->appender<1>().IsStarted());
+}
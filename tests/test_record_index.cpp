@@ -0,0 +1,71 @@
+//
+// Created by Ivan Shynkarenka on 18.10.2026
+//
+
+#include "test.h"
+
+#include "logging/appenders/file_appender.h"
+
+using namespace CppCommon;
+using namespace CppLogging;
+
+TEST_CASE("Logging records index", "[CppLogging]")
+{
+    File file("test.idx.log");
+    {
+        FileAppender appender(file, true, false, true, true);
+
+        Record record;
+        record.raw.resize(101);
+        for (int i = 0; i < 3000; ++i)
+        {
+            record.timestamp = 1000 + i;
+            record.level = (i == 2500) ? Level::ERROR : Level::INFO;
+            record.logger = (i == 2500) ? "error" : "info";
+            appender.AppendRecord(record);
+        }
+    }
+    REQUIRE(file.IsFileExists());
+    REQUIRE(RecordIndex::IndexPath(file).IsExists());
+
+    // Read index entries
+    std::vector<RecordIndex::Entry> entries;
+    REQUIRE(RecordIndex::Read(file, entries));
+    REQUIRE(entries.size() == 3);
+    REQUIRE(entries[0].timestamp == 1000);
+    REQUIRE(entries[0].first == 1000);
+    REQUIRE(entries[0].last == 2023);
+    REQUIRE(entries[0].offset == 0);
+    REQUIRE(entries[0].size == 102400);
+    REQUIRE(entries[0].records == 1024);
+    REQUIRE(entries[1].offset == 102400);
+    REQUIRE(entries[2].offset == 204800);
+    REQUIRE(entries[2].records == 952);
+    REQUIRE(entries[2].last == 3999);
+
+    // Match blocks by time range, logging level and logger name
+    uint32_t all = RecordIndex::LevelMask(Level::ALL);
+    REQUIRE(RecordIndex::Match(entries[0], 1500, 1600, all, 0));
+    REQUIRE(!RecordIndex::Match(entries[1], 1500, 1600, all, 0));
+    REQUIRE(!RecordIndex::Match(entries[0], 0, 5000, RecordIndex::LevelMask(Level::ERROR), 0));
+    REQUIRE(RecordIndex::Match(entries[2], 0, 5000, RecordIndex::LevelMask(Level::ERROR), 0));
+    REQUIRE(RecordIndex::Match(entries[2], 0, 5000, all, RecordIndex::LoggerBits("error")));
+    REQUIRE(RecordIndex::Match(entries[0], 0, 5000, all, RecordIndex::LoggerBits("info")));
+
+    // Append index entries for the existing logging file
+    {
+        FileAppender appender(file, false, false, true, true);
+
+        Record record;
+        record.raw.resize(101);
+        record.timestamp = 5000;
+        appender.AppendRecord(record);
+    }
+    REQUIRE(RecordIndex::Read(file, entries));
+    REQUIRE(entries.size() == 4);
+    REQUIRE(entries[3].offset == 300000);
+    REQUIRE(entries[3].timestamp == 5000);
+
+    File::Remove(file);
+    File::Remove(RecordIndex::IndexPath(file));
+}
@@ -6,193 +6,1014 @@
     \copyright MIT License
 */
 
+#include "logging/chunk_decoder.h"
+#include "logging/gzip_reader.h"
+#include "logging/mapped_file.h"
 #include "logging/record.h"
+#include "logging/record_index.h"
+#include "logging/rolling_manifest.h"
+#include "logging/appenders/block_file_appender.h"
+#include "logging/appenders/striped_file_appender.h"
+#include "logging/layouts/binary_layout_v2.h"
 #include "logging/layouts/text_layout.h"
 #include "logging/version.h"
-
-#include "../source/logging/appenders/minizip/unzip.h"
-#if defined(_WIN32) || defined(_WIN64)
-#include "../source/logging/appenders/minizip/iowin32.h"
-#endif
+#include "logging/zip_reader.h"
 
 #include "errors/fatal.h"
 #include "filesystem/file.h"
 #include "system/stream.h"
+#include "time/time.h"
 #include "utility/countof.h"
-#include "utility/resource.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
 
+#include <zlib.h>
+
 using namespace CppCommon;
 using namespace CppLogging;
 
-Path UnzipFile(const Path& path)
+void DeserializeRecord(const uint8_t* buffer, Record& record)
 {
-    // Open a zip archive
-    unzFile unzf;
-#if defined(_WIN32) || defined(_WIN64)
-    zlib_filefunc64_def ffunc;
-    fill_win32_filefunc64W(&ffunc);
-    unzf = unzOpen2_64(path.wstring().c_str(), &ffunc);
-#else
-    unzf = unzOpen64(path.string().c_str());
-#endif
-    if (unzf == nullptr)
-        throwex FileSystemException("Cannot open a zip archive!").Attach(path);
+    // Deserialize logging record
+    std::memcpy(&record.timestamp, buffer, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+    std::memcpy(&record.thread, buffer, sizeof(uint64_t));
+    buffer += sizeof(uint64_t);
+    std::memcpy(&record.level, buffer, sizeof(Level));
+    buffer += sizeof(Level);
 
-    // Smart resource cleaner pattern
-    auto unzip = resource(unzf, [](unzFile handle) { unzClose(handle); });
+    // Deserialize the logger name
+    uint8_t logger_size;
+    std::memcpy(&logger_size, buffer, sizeof(uint8_t));
+    buffer += sizeof(uint8_t);
+    record.logger.assign((const char*)buffer, logger_size);
+    buffer += logger_size;
 
-    File destination(path + ".tmp");
+    // Deserialize the logging message
+    uint16_t message_size;
+    std::memcpy(&message_size, buffer, sizeof(uint16_t));
+    buffer += sizeof(uint16_t);
+    record.message.assign((const char*)buffer, message_size);
+    buffer += message_size;
 
-    // Open the destination file for writing
-    destination.Create(false, true);
+    // Deserialize the logging buffer
+    uint32_t buffer_size;
+    std::memcpy(&buffer_size, buffer, sizeof(uint32_t));
+    buffer += sizeof(uint32_t);
+    record.buffer.assign(buffer, buffer + buffer_size);
+}
+
+bool InputRecord(Reader& input, Record& record)
+{
+    // Clear the logging record
+    record.Clear();
+
+    // Read the logging record size
+    uint32_t size;
+    if (input.Read(&size, sizeof(uint32_t)) != sizeof(uint32_t))
+        return false;
 
-    // Get info about the zip archive
-    unz_global_info global_info;
-    int result = unzGetGlobalInfo(unzf, &global_info);
-    if (result != UNZ_OK)
-        throwex FileSystemException("Cannot read a zip archive global info!").Attach(path);
+    record.raw.resize(size);
 
-    // Loop to extract all files from the zip archive
-    uLong i;
-    for (i = 0; i < global_info.number_entry; ++i)
+    // Read the logging record raw data
+    if (input.Read(record.raw.data(), size) != size)
     {
-        unz_file_info file_info;
-        char filename[1024];
+        std::cerr << "Failed to read from the input source!" << std::endl;
+        return false;
+    }
 
-        // Get info about the current file in the zip archive
-        result = unzGetCurrentFileInfo(unzf, &file_info, filename, (unsigned)countof(filename), NULL, 0, NULL, 0);
-        if (result != UNZ_OK)
-            throwex FileSystemException("Cannot read a zip archive file info!").Attach(path);
+    DeserializeRecord(record.raw.data(), record);
+    return true;
+}
 
-        // Check if this entry is a file
-        const size_t filename_length = strlen(filename);
-        if (filename[filename_length - 1] != '/')
+class PrefixReader : public Reader
+{
+public:
+    PrefixReader(Reader& input, const uint8_t* prefix, size_t size) : _input(input), _prefix(prefix, prefix + size) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size_t result = std::min(size, _prefix.size() - _offset);
+        std::memcpy(buffer, _prefix.data() + _offset, result);
+        _offset += result;
+        if (result < size)
+            result += _input.Read((uint8_t*)buffer + result, size - result);
+        return result;
+    }
+
+private:
+    Reader& _input;
+    std::vector<uint8_t> _prefix;
+    size_t _offset{0};
+};
+
+class MemoryReader : public Reader
+{
+public:
+    MemoryReader(const uint8_t* data, size_t size) : _data(data), _size(size) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size_t result = std::min(size, _size - _offset);
+        std::memcpy(buffer, _data + _offset, result);
+        _offset += result;
+        return result;
+    }
+
+private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _offset{0};
+};
+
+bool IsSyncFrame(const uint8_t* buffer, size_t size)
+{
+    if ((size < BinaryLayoutV2::SYNC_SIZE) || (std::memcmp(buffer, BinaryLayoutV2::MAGIC, sizeof(BinaryLayoutV2::MAGIC)) != 0) || (buffer[4] != BinaryLayoutV2::VERSION))
+        return false;
+
+    uint32_t crc;
+    std::memcpy(&crc, buffer + BinaryLayoutV2::SYNC_SIZE - sizeof(uint32_t), sizeof(uint32_t));
+    return (crc == BinaryLayoutV2::CRC32C(buffer, BinaryLayoutV2::SYNC_SIZE - sizeof(uint32_t)));
+}
+
+class InputRecordV2
+{
+public:
+    //! Maximal supported logging record payload size
+    static const size_t MAX_PAYLOAD = 16 * 1024 * 1024;
+
+    InputRecordV2(Reader& input, const uint8_t* prefix, size_t size) : _input(input), _buffer(prefix, prefix + size) {}
+
+    //! Restore the timestamp delta chain from the known timestamp of the first logging record
+    void Seed(uint64_t timestamp) noexcept
+    {
+        _seeded = true;
+        _seed = timestamp;
+    }
+
+    uint64_t skipped() const noexcept { return _skipped; }
+    uint64_t lost() const noexcept { return _lost; }
+
+    bool Next(Record& record)
+    {
+        while (_ready.empty())
         {
-            // Open the current file in the zip archive
-            result = unzOpenCurrentFile(unzf);
-            if (result != UNZ_OK)
-                throwex FileSystemException("Cannot open a current file in the zip archive!").Attach(path);
+            // Check for the end of the input source
+            if (!Fill(1))
+            {
+                Lost();
+                return false;
+            }
+
+            // Try to read the sync frame
+            if ((_buffer[_offset] == BinaryLayoutV2::MAGIC[0]) && ReadSync())
+                continue;
+
+            // Try to read the logging record frame
+            if ((_buffer[_offset] == BinaryLayoutV2::RECORD_TAG) && ReadRecord())
+                continue;
+
+            // Skip the corrupted byte and break the timestamp delta chain
+            ++_offset;
+            ++_skipped;
+            _synced = false;
+            Lost();
+        }
+
+        record = std::move(_ready.front());
+        _ready.pop_front();
+        return true;
+    }
+
+private:
+    Reader& _input;
+    std::vector<uint8_t> _buffer;
+    size_t _offset{0};
+    bool _eof{false};
+    bool _synced{false};
+    bool _seeded{false};
+    uint64_t _seed{0};
+    uint64_t _timestamp{0};
+    uint64_t _skipped{0};
+    uint64_t _lost{0};
+    std::deque<Record> _orphans;
+    std::deque<Record> _ready;
+
+    bool Fill(size_t size)
+    {
+        if ((_buffer.size() - _offset) >= size)
+            return true;
+
+        // Compact the input buffer
+        _buffer.erase(_buffer.begin(), _buffer.begin() + _offset);
+        _offset = 0;
+
+        // Read more data from the input source
+        while (!_eof && (_buffer.size() < size))
+        {
+            size_t offset = _buffer.size();
+            _buffer.resize(offset + std::max(size - offset, (size_t)65536));
+            size_t result = _input.Read(_buffer.data() + offset, _buffer.size() - offset);
+            _buffer.resize(offset + result);
+            if (result == 0)
+                _eof = true;
+        }
+
+        return (_buffer.size() >= size);
+    }
+
+    void Lost()
+    {
+        // Logging records without the sync frame cannot restore timestamps
+        _lost += _orphans.size();
+        _orphans.clear();
+    }
+
+    bool ReadSync()
+    {
+        if (!Fill(BinaryLayoutV2::SYNC_SIZE))
+            return false;
+
+        const uint8_t* buffer = _buffer.data() + _offset;
+        if (!IsSyncFrame(buffer, _buffer.size() - _offset))
+            return false;
 
-            // Smart resource cleaner pattern
-            auto unzip_file = resource(unzf, [](unzFile handle) { unzCloseCurrentFile(handle); });
+        uint64_t base;
+        std::memcpy(&base, buffer + 6, sizeof(uint64_t));
+        _offset += BinaryLayoutV2::SYNC_SIZE;
 
-            // Read data from the current file in the zip archive
-            do
+        // Restore timestamps of orphan logging records backward from the sync frame base timestamp
+        uint64_t timestamp = base;
+        for (auto it = _orphans.rbegin(); it != _orphans.rend(); ++it)
+        {
+            uint64_t delta = it->timestamp;
+            it->timestamp = timestamp;
+            timestamp -= delta;
+        }
+        for (auto& orphan : _orphans)
+            _ready.emplace_back(std::move(orphan));
+        _orphans.clear();
+
+        _synced = true;
+        _seeded = false;
+        _timestamp = base;
+        return true;
+    }
+
+    bool ReadRecord()
+    {
+        // Read the logging record frame header
+        Fill(1 + 10);
+        uint64_t size;
+        size_t header = BinaryLayoutV2::ReadVarint(_buffer.data() + _offset + 1, _buffer.size() - _offset - 1, size);
+        if ((header == 0) || (size > MAX_PAYLOAD))
+            return false;
+        header += 1;
+
+        // Read the logging record frame and validate its checksum
+        if (!Fill(header + size + sizeof(uint32_t)))
+            return false;
+        const uint8_t* payload = _buffer.data() + _offset + header;
+        uint32_t crc;
+        std::memcpy(&crc, payload + size, sizeof(uint32_t));
+        if (crc != BinaryLayoutV2::CRC32C(payload, (size_t)size))
+            return false;
+
+        Record record;
+        int64_t delta;
+        if (!ReadPayload(payload, (size_t)size, record, delta))
+            return false;
+        _offset += header + size + sizeof(uint32_t);
+
+        // Start the timestamp delta chain from the seed timestamp
+        if (_seeded)
+        {
+            _synced = true;
+            _seeded = false;
+            _timestamp = _seed - delta;
+        }
+
+        if (_synced)
+        {
+            // Restore the logging record timestamp forward from the previous one
+            _timestamp += delta;
+            record.timestamp = _timestamp;
+            _ready.emplace_back(std::move(record));
+        }
+        else
+        {
+            // Keep the timestamp delta until the next sync frame
+            record.timestamp = (uint64_t)delta;
+            _orphans.emplace_back(std::move(record));
+        }
+        return true;
+    }
+
+    static bool ReadPayload(const uint8_t* buffer, size_t size, Record& record, int64_t& delta)
+    {
+        size_t offset = 0;
+        uint64_t value;
+
+        // Deserialize the timestamp delta
+        size_t result = BinaryLayoutV2::ReadVarint(buffer + offset, size - offset, value);
+        if (result == 0)
+            return false;
+        offset += result;
+        delta = (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+
+        // Deserialize the thread Id
+        result = BinaryLayoutV2::ReadVarint(buffer + offset, size - offset, record.thread);
+        if (result == 0)
+            return false;
+        offset += result;
+
+        // Deserialize the logging level
+        if ((size - offset) < sizeof(Level))
+            return false;
+        std::memcpy(&record.level, buffer + offset, sizeof(Level));
+        offset += sizeof(Level);
+
+        // Deserialize the logger name
+        result = BinaryLayoutV2::ReadVarint(buffer + offset, size - offset, value);
+        if ((result == 0) || (value > (size - offset - result)))
+            return false;
+        offset += result;
+        record.logger.assign((const char*)buffer + offset, (size_t)value);
+        offset += (size_t)value;
+
+        // Deserialize the logging message
+        result = BinaryLayoutV2::ReadVarint(buffer + offset, size - offset, value);
+        if ((result == 0) || (value > (size - offset - result)))
+            return false;
+        offset += result;
+        record.message.assign((const char*)buffer + offset, (size_t)value);
+        offset += (size_t)value;
+
+        // Deserialize the logging buffer
+        result = BinaryLayoutV2::ReadVarint(buffer + offset, size - offset, value);
+        if ((result == 0) || (value > (size - offset - result)))
+            return false;
+        offset += result;
+        record.buffer.assign(buffer + offset, buffer + offset + (size_t)value);
+        offset += (size_t)value;
+
+        return (offset == size);
+    }
+};
+
+bool ReadExact(Reader& input, void* buffer, size_t size)
+{
+    size_t offset = 0;
+    while (offset < size)
+    {
+        size_t result = input.Read((uint8_t*)buffer + offset, size - offset);
+        if (result == 0)
+            return false;
+        offset += result;
+    }
+    return true;
+}
+
+class BlockReader : public Reader
+{
+public:
+    BlockReader(Reader& input, uint64_t to) : _input(input), _to(to) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size_t result = 0;
+        while (result < size)
+        {
+            // Inflate the next block
+            if (_offset == _data.size())
             {
-                uint8_t buffer[16384];
-                result = unzReadCurrentFile(unzf, buffer, (unsigned)countof(buffer));
-                if (result > 0)
-                    destination.Write(buffer, (size_t)result);
-                else if (result < 0)
-                    throwex FileSystemException("Cannot read the current file from the zip archive!").Attach(path);
-            } while (result != UNZ_EOF);
+                if (_end || !NextBlock())
+                {
+                    _end = true;
+                    break;
+                }
+            }
+
+            size_t count = std::min(size - result, _data.size() - _offset);
+            std::memcpy((uint8_t*)buffer + result, _data.data() + _offset, count);
+            _offset += count;
+            result += count;
+        }
+        return result;
+    }
+
+    const std::vector<uint8_t>& block() const noexcept { return _data; }
 
-            // Close the current file in the zip archive
-            result = unzCloseCurrentFile(unzf);
-            if (result != UNZ_OK)
-                throwex FileSystemException("Cannot close the current file in the zip archive!").Attach(path);
-            unzip_file.release();
+    bool NextBlock()
+    {
+        for (;;)
+        {
+            // Read the block header
+            uint8_t header[BlockFileAppender::BLOCK_HEADER_SIZE];
+            if (!ReadExact(_input, header, sizeof(header)))
+                return false;
+
+            // Stop at the block index
+            if (std::memcmp(header, BlockFileAppender::INDEX_MAGIC, sizeof(BlockFileAppender::INDEX_MAGIC)) == 0)
+                return false;
+
+            uint32_t compressed, raw, records, crc;
+            uint64_t first, last;
+            if (!BlockFileAppender::ParseBlockHeader(header, compressed, raw, records, first, last, crc))
+            {
+                std::cerr << "Corrupted block header!" << std::endl;
+                return false;
+            }
+
+            // Stop at the block after the requested time range
+            if (first > _to)
+                return false;
+
+            // Read and validate compressed data
+            _compressed.resize(compressed);
+            if (!ReadExact(_input, _compressed.data(), _compressed.size()))
+                return false;
+            if (crc != BinaryLayoutV2::CRC32C(_compressed.data(), _compressed.size()))
+            {
+                std::cerr << "Skipped corrupted block with " << records << " logging records" << std::endl;
+                continue;
+            }
+
+            // Inflate the block
+            _data.resize(raw);
+            uLongf size = (uLongf)raw;
+            if ((uncompress(_data.data(), &size, _compressed.data(), (uLong)_compressed.size()) != Z_OK) || (size != raw))
+            {
+                std::cerr << "Skipped corrupted block with " << records << " logging records" << std::endl;
+                continue;
+            }
+
+            _offset = 0;
+            return true;
         }
     }
 
-    // Close the destination file
-    destination.Close();
+private:
+    Reader& _input;
+    uint64_t _to;
+    std::vector<uint8_t> _compressed;
+    std::vector<uint8_t> _data;
+    size_t _offset{0};
+    bool _end{false};
+};
 
-    // Close the zip archive
-    result = unzClose(unzf);
-    if (result != UNZ_OK)
-        throwex FileSystemException("Cannot close the zip archive!").Attach(path);
-    unzip.release();
+uint64_t ParseTimestamp(const std::string& value)
+{
+    // Timestamp in nanoseconds since Unix epoch
+    if (!value.empty() && (value.find_first_not_of("0123456789") == std::string::npos))
+        return std::stoull(value);
+
+    // UTC time in ISO 8601 format
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    if (std::sscanf(value.c_str(), "%d-%d-%dT%d:%d:%d", &year, &month, &day, &hour, &minute, &second) < 3)
+        throwex ArgumentException("Invalid timestamp format: " + value);
 
-    return std::move(destination);
+    return UtcTime(year, month, day, hour, minute, second).utcstamp().total();
 }
 
-bool InputRecord(Reader& input, Record& record)
+Level ParseLevel(const std::string& value)
 {
-    // Clear the logging record
-    record.Clear();
+    if (value == "NONE")
+        return Level::NONE;
+    if (value == "FATAL")
+        return Level::FATAL;
+    if (value == "ERROR")
+        return Level::ERROR;
+    if (value == "WARN")
+        return Level::WARN;
+    if (value == "INFO")
+        return Level::INFO;
+    if (value == "DEBUG")
+        return Level::DEBUG;
+    if (value == "ALL")
+        return Level::ALL;
 
-    // Read the logging record size
-    uint32_t size;
-    if (input.Read(&size, sizeof(uint32_t)) != sizeof(uint32_t))
-        return false;
+    throwex ArgumentException("Invalid logging level: " + value);
+}
 
-    record.raw.resize(size);
+//! Logging records filter
+struct Filter
+{
+    uint64_t from{0};
+    uint64_t to{std::numeric_limits<uint64_t>::max()};
+    Level level{Level::ALL};
+    bool filter_logger{false};
+    std::string logger;
 
-    // Read the logging record raw data
-    if (input.Read(record.raw.data(), size) != size)
+    bool Match(const Record& record) const
     {
-        std::cerr << "Failed to read from the input source!" << std::endl;
+        return (record.timestamp >= from) && (record.timestamp <= to) && (record.level <= level) && (!filter_logger || (record.logger == logger));
+    }
+
+    bool Match(const RecordIndex::Entry& entry) const
+    {
+        return RecordIndex::Match(entry, from, to, RecordIndex::LevelMask(level), filter_logger ? RecordIndex::LoggerBits(logger) : 0);
+    }
+};
+
+bool OutputRecord(Writer& output, TextLayout& layout, Record& record)
+{
+    layout.LayoutRecord(record);
+
+    size_t size = record.raw.size() - 1;
+    if (output.Write(record.raw.data(), size) != size)
+    {
+        std::cerr << "Failed to write into the output source!" << std::endl;
         return false;
     }
 
-    // Get the buffer start position
-    const uint8_t* buffer = record.raw.data();
+    return true;
+}
 
-    // Deserialize logging record
-    std::memcpy(&record.timestamp, buffer, sizeof(uint64_t));
-    buffer += sizeof(uint64_t);
-    std::memcpy(&record.thread, buffer, sizeof(uint64_t));
-    buffer += sizeof(uint64_t);
-    std::memcpy(&record.level, buffer, sizeof(Level));
-    buffer += sizeof(Level);
+void ProcessColumns(BlockReader& blocks, Writer& output, const Filter& filter)
+{
+    // Process all logging records of blocks with columns encoding
+    TextLayout layout;
+    std::vector<Record> records;
+    while (blocks.NextBlock())
+    {
+        if (!BlockFileAppender::DecodeColumns(blocks.block().data(), blocks.block().size(), records))
+        {
+            std::cerr << "Skipped corrupted block columns" << std::endl;
+            continue;
+        }
 
-    // Deserialize the logger name
-    uint8_t logger_size;
-    std::memcpy(&logger_size, buffer, sizeof(uint8_t));
-    buffer += sizeof(uint8_t);
-    record.logger.insert(record.logger.begin(), buffer, buffer + logger_size);
-    buffer += logger_size;
+        for (auto& record : records)
+            if (filter.Match(record))
+                if (!OutputRecord(output, layout, record))
+                    return;
+    }
+}
 
-    // Deserialize the logging message
-    uint16_t message_size;
-    std::memcpy(&message_size, buffer, sizeof(uint16_t));
-    buffer += sizeof(uint16_t);
-    record.message.insert(record.message.begin(), buffer, buffer + message_size);
-    buffer += message_size;
+class StripeReader
+{
+public:
+    explicit StripeReader(Reader& input) : _input(input) {}
 
-    // Deserialize the logging buffer
-    uint32_t buffer_size;
-    std::memcpy(&buffer_size, buffer, sizeof(uint32_t));
-    buffer += sizeof(uint32_t);
-    record.buffer.insert(record.buffer.begin(), buffer, buffer + buffer_size);
-    buffer += buffer_size;
+    uint16_t index() const noexcept { return _index; }
+    uint16_t count() const noexcept { return _count; }
+    uint64_t sequence() const noexcept { return _sequence; }
+    const std::vector<uint8_t>& frame() const noexcept { return _frame; }
 
-    // Skip the last zero byte
-    ++buffer;
+    //! Read and validate the stripe file header
+    bool Open()
+    {
+        uint8_t header[StripedFileAppender::FILE_HEADER_SIZE];
+        return ReadExact(_input, header, sizeof(header)) && StripedFileAppender::ParseFileHeader(header, _index, _count);
+    }
 
-    return true;
+    //! Read the next frame of the stripe file
+    bool Next()
+    {
+        uint8_t header[StripedFileAppender::FRAME_HEADER_SIZE];
+        if (!ReadExact(_input, header, sizeof(header)))
+            return false;
+
+        uint32_t size;
+        std::memcpy(&_sequence, header, sizeof(uint64_t));
+        std::memcpy(&size, header + sizeof(uint64_t), sizeof(uint32_t));
+
+        _frame.resize(size);
+        if (!ReadExact(_input, _frame.data(), _frame.size()))
+        {
+            std::cerr << "Skipped torn frame of the stripe " << _index << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    Reader& _input;
+    uint16_t _index{0};
+    uint16_t _count{0};
+    uint64_t _sequence{0};
+    std::vector<uint8_t> _frame;
+};
+
+void ProcessStripes(const std::vector<Reader*>& inputs, Writer& output, const Filter& filter)
+{
+    // Open all stripe files
+    std::vector<std::unique_ptr<StripeReader>> stripes;
+    for (auto input : inputs)
+    {
+        stripes.emplace_back(std::make_unique<StripeReader>(*input));
+        if (!stripes.back()->Open())
+            throwex ArgumentException("Invalid stripe file!");
+    }
+    if (stripes.front()->count() != stripes.size())
+        std::cerr << "Merged " << stripes.size() << " of " << stripes.front()->count() << " stripes" << std::endl;
+
+    // Read the first frame of each stripe
+    std::vector<StripeReader*> active;
+    for (auto& stripe : stripes)
+        if (stripe->Next())
+            active.push_back(stripe.get());
+
+    // Merge frames of all stripes in the order of their sequence numbers
+    Record record;
+    TextLayout layout;
+    while (!active.empty())
+    {
+        auto it = std::min_element(active.begin(), active.end(), [](const StripeReader* a, const StripeReader* b) { return a->sequence() < b->sequence(); });
+        StripeReader* stripe = *it;
+
+        MemoryReader reader(stripe->frame().data(), stripe->frame().size());
+        if (InputRecord(reader, record) && filter.Match(record))
+            if (!OutputRecord(output, layout, record))
+                return;
+
+        if (!stripe->Next())
+            active.erase(it);
+    }
 }
 
-bool OutputRecord(Writer& output, Record& record)
+void ProcessRecords(Reader& input, Writer& output, bool v2, const Filter& filter)
 {
+    // Detect the binary log version by the magic
+    uint8_t prefix[sizeof(BinaryLayoutV2::MAGIC)];
+    size_t prefix_size = 0;
+    while (prefix_size < countof(prefix))
+    {
+        size_t size = input.Read(prefix + prefix_size, countof(prefix) - prefix_size);
+        if (size == 0)
+            break;
+        prefix_size += size;
+    }
+
+    // Process the block file sequentially
+    if (!v2 && (prefix_size == countof(prefix)) && (std::memcmp(prefix, BlockFileAppender::FILE_MAGIC, countof(prefix)) == 0))
+    {
+        uint8_t header[BlockFileAppender::FILE_HEADER_SIZE - sizeof(BlockFileAppender::FILE_MAGIC)];
+        if (!ReadExact(input, header, sizeof(header)) || (header[0] != BlockFileAppender::VERSION))
+            throwex ArgumentException("Unsupported block file version!");
+
+        BlockReader blocks(input, filter.to);
+        if (header[1] == (uint8_t)BlockEncoding::COLUMNS)
+            ProcessColumns(blocks, output, filter);
+        else
+            ProcessRecords(blocks, output, false, filter);
+        return;
+    }
+
+    // Process the single stripe file of the striped file appender
+    if (!v2 && (prefix_size == countof(prefix)) && (std::memcmp(prefix, StripedFileAppender::FILE_MAGIC, countof(prefix)) == 0))
+    {
+        PrefixReader reader(input, prefix, prefix_size);
+        ProcessStripes({ &reader }, output, filter);
+        return;
+    }
+
+    Record record;
     TextLayout layout;
-    layout.LayoutRecord(record);
+    if (v2 || ((prefix_size == countof(prefix)) && (std::memcmp(prefix, BinaryLayoutV2::MAGIC, countof(prefix)) == 0)))
+    {
+        // Process all logging records of the binary log version 2
+        InputRecordV2 reader(input, prefix, prefix_size);
+        while (reader.Next(record))
+            if (filter.Match(record))
+                if (!OutputRecord(output, layout, record))
+                    break;
 
-    size_t size = record.raw.size() - 1;
-    if (output.Write(record.raw.data(), size) != size)
+        if (reader.skipped() > 0)
+            std::cerr << "Skipped " << reader.skipped() << " corrupted bytes" << std::endl;
+        if (reader.lost() > 0)
+            std::cerr << "Lost " << reader.lost() << " logging records without sync frame" << std::endl;
+    }
+    else
+    {
+        // Process all logging records of the binary log version 1
+        PrefixReader reader(input, prefix, prefix_size);
+        while (InputRecord(reader, record))
+            if (filter.Match(record))
+                if (!OutputRecord(output, layout, record))
+                    break;
+    }
+}
+
+//! Input chunk of the memory-mapped file
+using Chunk = ChunkDecoder::Chunk;
+
+//! Input chunk size
+const size_t CHUNK_SIZE = ChunkDecoder::CHUNK_SIZE;
+
+std::vector<Chunk> SplitRecords(const uint8_t* data, size_t size)
+{
+    std::vector<Chunk> chunks;
+
+    // Split logging records of the binary log version 1 at record boundaries
+    size_t start = 0;
+    size_t offset = 0;
+    while ((size - offset) >= sizeof(uint32_t))
+    {
+        uint32_t record_size;
+        std::memcpy(&record_size, data + offset, sizeof(uint32_t));
+        if ((size - offset - sizeof(uint32_t)) < record_size)
+        {
+            std::cerr << "Failed to read from the input source!" << std::endl;
+            break;
+        }
+        offset += sizeof(uint32_t) + record_size;
+
+        if ((offset - start) >= CHUNK_SIZE)
+        {
+            chunks.push_back({ data + start, offset - start, 0 });
+            start = offset;
+        }
+    }
+    if (offset > start)
+        chunks.push_back({ data + start, offset - start, 0 });
+
+    return chunks;
+}
+
+std::vector<Chunk> SplitFrames(const uint8_t* data, size_t size, uint64_t timestamp = 0)
+{
+    std::vector<Chunk> chunks;
+
+    // Split frames of the binary log version 2 at sync frames, so each chunk restores timestamps independently
+    size_t start = 0;
+    size_t offset = CHUNK_SIZE;
+    while (offset < size)
     {
+        const void* sync = std::memchr(data + offset, BinaryLayoutV2::MAGIC[0], size - offset);
+        if (sync == nullptr)
+            break;
+        offset = (const uint8_t*)sync - data;
+        if (!IsSyncFrame(data + offset, size - offset))
+        {
+            ++offset;
+            continue;
+        }
+
+        chunks.push_back({ data + start, offset - start, (start == 0) ? timestamp : 0 });
+        start = offset;
+        offset += CHUNK_SIZE;
+    }
+    chunks.push_back({ data + start, size - start, (start == 0) ? timestamp : 0 });
+
+    return chunks;
+}
+
+void FormatRecord(std::string& text, TextLayout& layout, Record& record)
+{
+    layout.LayoutRecord(record);
+    text.append((const char*)record.raw.data(), record.raw.size() - 1);
+}
+
+void ProcessChunks(const std::vector<Chunk>& chunks, Writer& output, size_t threads, const ChunkDecoder::Decoder& decoder)
+{
+    if (!ChunkDecoder::Decode(chunks, output, threads, decoder))
         std::cerr << "Failed to write into the output source!" << std::endl;
+}
+
+//! Range of the logging file to decode
+struct Range
+{
+    uint64_t offset;
+    uint64_t size;
+    uint64_t timestamp;     //!< Known timestamp of the first logging record or zero
+};
+
+std::vector<Range> SelectRanges(const std::vector<RecordIndex::Entry>& entries, uint64_t size, const Filter& filter)
+{
+    std::vector<Range> ranges;
+
+    // Select the given part of the file merging it with the previous selected one
+    auto select = [&ranges](uint64_t offset, uint64_t size, uint64_t timestamp)
+    {
+        if (!ranges.empty() && ((ranges.back().offset + ranges.back().size) == offset))
+            ranges.back().size += size;
+        else
+            ranges.push_back({ offset, size, timestamp });
+    };
+
+    uint64_t offset = 0;
+    const RecordIndex::Entry* previous = nullptr;
+    bool previous_selected = false;
+
+    // Parts of the file which are not covered by the index are always selected
+    // together with the previous block to restore the timestamp delta chain
+    auto select_gap = [&](uint64_t end)
+    {
+        if (end <= offset)
+            return;
+        if ((previous != nullptr) && !previous_selected)
+            select(previous->offset, previous->size, previous->timestamp);
+        select(offset, end - offset, 0);
+    };
+
+    // Select blocks which may contain matching logging records
+    for (const auto& entry : entries)
+    {
+        // Skip overlapped entries
+        if (entry.offset < offset)
+            continue;
+
+        select_gap(entry.offset);
+
+        previous_selected = filter.Match(entry);
+        if (previous_selected)
+            select(entry.offset, entry.size, entry.timestamp);
+
+        offset = entry.offset + entry.size;
+        previous = &entry;
+    }
+    select_gap(size);
+
+    return ranges;
+}
+
+bool ProcessMapped(const MappedFile& input, Writer& output, size_t threads, const Filter& filter)
+{
+    const uint8_t* data = input.data();
+    size_t size = input.size();
+
+    // Block files are processed sequentially block by block
+    if ((size >= sizeof(BlockFileAppender::FILE_MAGIC)) && (std::memcmp(data, BlockFileAppender::FILE_MAGIC, sizeof(BlockFileAppender::FILE_MAGIC)) == 0))
         return false;
+
+    // Read the logging records index to skip blocks which cannot contain matching logging records
+    std::vector<RecordIndex::Entry> entries;
+    std::vector<Range> ranges;
+    if (RecordIndex::Read(input.path(), entries))
+        ranges = SelectRanges(entries, size, filter);
+    else
+        ranges.push_back({ 0, size, 0 });
+
+    if ((size >= sizeof(BinaryLayoutV2::MAGIC)) && (std::memcmp(data, BinaryLayoutV2::MAGIC, sizeof(BinaryLayoutV2::MAGIC)) == 0))
+    {
+        // Split selected ranges at sync frames
+        std::vector<Chunk> chunks;
+        for (const auto& range : ranges)
+            for (const auto& chunk : SplitFrames(data + range.offset, (size_t)range.size, range.timestamp))
+                chunks.push_back(chunk);
+
+        // Process all logging records of the binary log version 2
+        std::atomic<uint64_t> skipped(0);
+        std::atomic<uint64_t> lost(0);
+        ProcessChunks(chunks, output, threads, [&](const Chunk& chunk, TextLayout& layout, Record& record, std::string& text)
+        {
+            MemoryReader reader(chunk.data, chunk.size);
+            InputRecordV2 input(reader, nullptr, 0);
+            if (chunk.timestamp != 0)
+                input.Seed(chunk.timestamp);
+            while (input.Next(record))
+                if (filter.Match(record))
+                    FormatRecord(text, layout, record);
+            skipped += input.skipped();
+            lost += input.lost();
+        });
+
+        if (skipped > 0)
+            std::cerr << "Skipped " << skipped << " corrupted bytes" << std::endl;
+        if (lost > 0)
+            std::cerr << "Lost " << lost << " logging records without sync frame" << std::endl;
+    }
+    else
+    {
+        // Split selected ranges at logging record boundaries
+        std::vector<Chunk> chunks;
+        for (const auto& range : ranges)
+            for (const auto& chunk : SplitRecords(data + range.offset, (size_t)range.size))
+                chunks.push_back(chunk);
+
+        // Process all logging records of the binary log version 1
+        ProcessChunks(chunks, output, threads, [&](const Chunk& chunk, TextLayout& layout, Record& record, std::string& text)
+        {
+            size_t offset = 0;
+            while (offset < chunk.size)
+            {
+                uint32_t record_size;
+                std::memcpy(&record_size, chunk.data + offset, sizeof(uint32_t));
+                offset += sizeof(uint32_t);
+                record.Clear();
+                DeserializeRecord(chunk.data + offset, record);
+                offset += record_size;
+                if (filter.Match(record))
+                    FormatRecord(text, layout, record);
+            }
+        });
     }
 
     return true;
 }
 
+void ProcessFile(File& input, Writer& output, size_t threads, const Filter& filter)
+{
+    // Process the single stripe file of the striped file appender sequentially
+    uint8_t magic[sizeof(StripedFileAppender::FILE_MAGIC)] = {};
+    if (ReadExact(input, magic, sizeof(magic)) && (std::memcmp(magic, StripedFileAppender::FILE_MAGIC, sizeof(magic)) == 0))
+    {
+        input.Seek(0);
+        ProcessRecords(input, output, false, filter);
+        return;
+    }
+    input.Seek(0);
+
+    // Seek by time in the block file using its block index
+    std::vector<BlockFileAppender::BlockIndex> index;
+    BlockEncoding encoding = BlockEncoding::ROWS;
+    if (BlockFileAppender::ReadIndex(input, index, &encoding) > 0)
+    {
+        // Detect the binary log version by the magic in the first block
+        uint8_t prefix[sizeof(BinaryLayoutV2::MAGIC)] = {};
+        input.Seek(BlockFileAppender::FILE_HEADER_SIZE);
+        BlockReader first(input, filter.to);
+        bool v2 = (encoding == BlockEncoding::ROWS) && ReadExact(first, prefix, sizeof(prefix)) && (std::memcmp(prefix, BinaryLayoutV2::MAGIC, sizeof(prefix)) == 0);
+
+        // Find the first block with logging records in the time range
+        auto it = std::find_if(index.begin(), index.end(), [&filter](const BlockFileAppender::BlockIndex& block) { return block.last >= filter.from; });
+        if (it != index.end())
+        {
+            input.Seek(it->offset);
+            BlockReader blocks(input, filter.to);
+            if (encoding == BlockEncoding::COLUMNS)
+                ProcessColumns(blocks, output, filter);
+            else
+                ProcessRecords(blocks, output, v2, filter);
+        }
+    }
+    else
+    {
+        // Decode the memory-mapped input file in parallel
+        MappedFile mapped;
+        if (!mapped.Map(input) || !ProcessMapped(mapped, output, threads, filter))
+        {
+            input.Seek(0);
+            ProcessRecords(input, output, false, filter);
+        }
+    }
+}
+
+void ProcessGzip(const Path& path, Writer& output, const Filter& filter)
+{
+    GzipReader input(path);
+    ProcessRecords(input, output, false, filter);
+    if (input.skipped() > 0)
+        std::cerr << "Skipped " << input.skipped() << " corrupted compressed bytes" << std::endl;
+}
+
+void ProcessDirectory(const Path& path, Writer& output, size_t threads, const Filter& filter)
+{
+    std::vector<RollingManifest::Entry> entries;
+    if (!RollingManifest::Read(path, entries))
+        throwex FileSystemException("Cannot read the rolling manifest!").Attach(path);
+
+    // Skip logging files which cannot contain matching logging records without opening them
+    for (const auto& entry : entries)
+    {
+        if (!entry.Match(filter.from, filter.to, filter.level))
+            continue;
+
+        File file(path / entry.filename);
+        if (!file.IsFileExists())
+            continue;
+
+        if (file.extension() == ".zip")
+        {
+            ZipReader input(file);
+            ProcessRecords(input, output, false, filter);
+        }
+        else if (file.extension() == ".gz")
+            ProcessGzip(file, output, filter);
+        else
+        {
+            file.Open(true, false);
+            ProcessFile(file, output, threads, filter);
+            file.Close();
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
-    auto parser = optparse::OptionParser().version(version);
+    auto parser = optparse::OptionParser().version(version).usage("%prog [options] [stripe files]");
 
-    parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-i", "--input").dest("input").help("Input file name or rolling directory with the manifest");
     parser.add_option("-o", "--output").dest("output").help("Output file name");
+    parser.add_option("-f", "--from").dest("from").help("Output logging records from the given UTC time (YYYY-MM-DDTHH:MM:SS) or nanoseconds timestamp");
+    parser.add_option("-t", "--to").dest("to").help("Output logging records to the given UTC time (YYYY-MM-DDTHH:MM:SS) or nanoseconds timestamp");
+    parser.add_option("-l", "--level").dest("level").help("Output logging records with the given level (FATAL, ERROR, WARN, INFO, DEBUG) or more severe");
+    parser.add_option("-g", "--logger").dest("logger").help("Output logging records of the given logger");
+    parser.add_option("-j", "--threads").dest("threads").help("Number of threads to decode the input file (default is the number of CPU cores)");
+    parser.add_option("-s", "--seek").dest("seek").help("Seek to the given offset of the binary log version 2 input and read from the next valid frame");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -205,18 +1026,31 @@ int main(int argc, char** argv)
 
     try
     {
-        Path temp_file;
-
         // Open the input file or stdin
+        File* input_file = nullptr;
+        GzipReader* input_gzip = nullptr;
+        Path directory;
         std::unique_ptr<Reader> input(new StdInput());
         if (options.is_set("input"))
         {
             Path path(options.get("input"));
-            if (path.IsRegularFile() && (path.extension() == ".zip"))
-                temp_file = path = UnzipFile(path);
-            File* file = new File(path);
-            file->Open(true, false);
-            input.reset(file);
+            if (path.IsDirectory())
+                directory = path;
+            else if (path.IsRegularFile() && (path.extension() == ".zip"))
+                input.reset(new ZipReader(path));
+            else if (path.IsRegularFile() && (path.extension() == ".gz"))
+            {
+                GzipReader* gzip = new GzipReader(path);
+                input.reset(gzip);
+                input_gzip = gzip;
+            }
+            else
+            {
+                File* file = new File(path);
+                file->Open(true, false);
+                input.reset(file);
+                input_file = file;
+            }
         }
 
         // Open the output file or stdout
@@ -228,15 +1062,83 @@ int main(int argc, char** argv)
             output.reset(file);
         }
 
-        // Process all logging records
-        Record record;
-        while (InputRecord(*input, record))
-            if (!OutputRecord(*output, record))
-                break;
+        // Prepare the logging records filter
+        Filter filter;
+        if (options.is_set("from"))
+            filter.from = ParseTimestamp(options.get("from"));
+        if (options.is_set("to"))
+            filter.to = ParseTimestamp(options.get("to"));
+        if (options.is_set("level"))
+            filter.level = ParseLevel(options.get("level"));
+        if (options.is_set("logger"))
+        {
+            filter.filter_logger = true;
+            filter.logger = std::string(options.get("logger"));
+        }
+
+        size_t threads = options.is_set("threads") ? (size_t)std::stoul(std::string(options.get("threads"))) : (size_t)std::thread::hardware_concurrency();
+        threads = std::max(threads, (size_t)1);
+
+        // Merge the input file with stripe files of the striped file appender
+        if (!parser.args().empty())
+        {
+            // Plain, zip and gzip input files are merged as the first stripe, the rolling directory cannot be merged
+            if (!directory.empty())
+                throwex ArgumentException("Rolling directory cannot be merged with stripe files!");
+
+            std::vector<std::unique_ptr<File>> stripes;
+            std::vector<Reader*> inputs;
+            if (options.is_set("input"))
+                inputs.push_back(input.get());
+            for (const auto& arg : parser.args())
+            {
+                stripes.emplace_back(std::make_unique<File>(Path(arg)));
+                stripes.back()->Open(true, false);
+                inputs.push_back(stripes.back().get());
+            }
+            ProcessStripes(inputs, *output, filter);
+            return 0;
+        }
+
+        // Process logging files of the rolling directory
+        if (!directory.empty())
+        {
+            ProcessDirectory(directory, *output, threads, filter);
+            return 0;
+        }
+
+        // Seek to the given offset of the input source
+        bool seek = options.is_set("seek");
+        if (seek)
+        {
+            uint64_t offset = std::stoull(std::string(options.get("seek")));
+            if (input_file != nullptr)
+            {
+                // Seek the regular input file directly, but not beyond its end
+                input_file->Seek(std::min(offset, input_file->size()));
+            }
+            else
+            {
+                // Compressed inputs and stdin could be only read and discarded up to the given offset
+                uint8_t buffer[16384];
+                while (offset > 0)
+                {
+                    size_t size = input->Read(buffer, (size_t)std::min(offset, (uint64_t)countof(buffer)));
+                    if (size == 0)
+                        break;
+                    offset -= size;
+                }
+            }
+        }
+
+        // Process the input file using its block index or memory mapping
+        if (!seek && (input_file != nullptr))
+            ProcessFile(*input_file, *output, threads, filter);
+        else
+            ProcessRecords(*input, *output, seek, filter);
 
-        // Delete temporary file
-        if (temp_file)
-            Path::Remove(temp_file);
+        if ((input_gzip != nullptr) && (input_gzip->skipped() > 0))
+            std::cerr << "Skipped " << input_gzip->skipped() << " corrupted compressed bytes" << std::endl;
 
         return 0;
     }
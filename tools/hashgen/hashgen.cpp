@@ -0,0 +1,319 @@
+/*!
+    \file hashgen.cpp
+    \brief Hash logs map generator definition
+    \author Ivan Shynkarenka
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "logging/hashlog.h"
+#include "logging/layouts/hash_layout.h"
+#include "logging/layouts/hash64_layout.h"
+#include "logging/version.h"
+
+#include "errors/fatal.h"
+#include "filesystem/file.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppLogging;
+
+//! Source token
+struct Token
+{
+    enum class Type { IDENTIFIER, STRING, PUNCTUATION };
+
+    Type type;
+    std::string text;
+};
+
+std::string ReadSource(const Path& path)
+{
+    File source(path);
+    source.Open(true, false);
+    std::string content(source.size(), 0);
+    size_t size = source.Read(content.data(), content.size());
+    content.resize(size);
+    source.Close();
+    return content;
+}
+
+size_t ParseEscape(const std::string& source, size_t i, std::string& result)
+{
+    // Parse the escape sequence started after the backslash
+    char ch = source[i++];
+    switch (ch)
+    {
+        case 'a': result += '\a'; break;
+        case 'b': result += '\b'; break;
+        case 'f': result += '\f'; break;
+        case 'n': result += '\n'; break;
+        case 'r': result += '\r'; break;
+        case 't': result += '\t'; break;
+        case 'v': result += '\v'; break;
+        case 'x':
+        {
+            unsigned value = 0;
+            while ((i < source.size()) && std::isxdigit((unsigned char)source[i]))
+                value = value * 16 + (unsigned)(std::isdigit((unsigned char)source[i]) ? (source[i++] - '0') : (std::tolower((unsigned char)source[i++]) - 'a' + 10));
+            result += (char)value;
+            break;
+        }
+        default:
+        {
+            if ((ch >= '0') && (ch <= '7'))
+            {
+                unsigned value = (unsigned)(ch - '0');
+                for (int j = 0; (j < 2) && (i < source.size()) && (source[i] >= '0') && (source[i] <= '7'); ++j)
+                    value = value * 8 + (unsigned)(source[i++] - '0');
+                result += (char)value;
+            }
+            else
+                result += ch;
+            break;
+        }
+    }
+    return i;
+}
+
+std::vector<Token> Tokenize(const std::string& source)
+{
+    std::vector<Token> tokens;
+
+    size_t i = 0;
+    while (i < source.size())
+    {
+        char ch = source[i];
+
+        // Skip whitespaces
+        if (std::isspace((unsigned char)ch))
+        {
+            ++i;
+            continue;
+        }
+
+        // Skip comments
+        if ((ch == '/') && ((i + 1) < source.size()) && (source[i + 1] == '/'))
+        {
+            i = source.find('\n', i);
+            if (i == std::string::npos)
+                break;
+            continue;
+        }
+        if ((ch == '/') && ((i + 1) < source.size()) && (source[i + 1] == '*'))
+        {
+            i = source.find("*/", i + 2);
+            if (i == std::string::npos)
+                break;
+            i += 2;
+            continue;
+        }
+
+        // Parse identifiers and string literal prefixes
+        if (std::isalpha((unsigned char)ch) || (ch == '_'))
+        {
+            size_t start = i;
+            while ((i < source.size()) && (std::isalnum((unsigned char)source[i]) || (source[i] == '_')))
+                ++i;
+            std::string identifier = source.substr(start, i - start);
+
+            // Parse raw string literals
+            if ((i < source.size()) && (source[i] == '"') && ((identifier == "R") || (identifier == "u8R")))
+            {
+                size_t open = source.find('(', i);
+                if (open == std::string::npos)
+                    break;
+                std::string delimiter = ")" + source.substr(i + 1, open - i - 1) + "\"";
+                size_t close = source.find(delimiter, open);
+                if (close == std::string::npos)
+                    break;
+                tokens.push_back({ Token::Type::STRING, source.substr(open + 1, close - open - 1) });
+                i = close + delimiter.size();
+                continue;
+            }
+
+            // Skip the UTF-8 string literal prefix
+            if ((i < source.size()) && (source[i] == '"') && (identifier == "u8"))
+                continue;
+
+            tokens.push_back({ Token::Type::IDENTIFIER, identifier });
+            continue;
+        }
+
+        // Skip numbers
+        if (std::isdigit((unsigned char)ch))
+        {
+            while ((i < source.size()) && (std::isalnum((unsigned char)source[i]) || (source[i] == '.') || (source[i] == '\'')))
+                ++i;
+            continue;
+        }
+
+        // Parse string and character literals
+        if ((ch == '"') || (ch == '\''))
+        {
+            std::string literal;
+            ++i;
+            while ((i < source.size()) && (source[i] != ch) && (source[i] != '\n'))
+            {
+                if ((source[i] == '\\') && ((i + 1) < source.size()))
+                    i = ParseEscape(source, i + 1, literal);
+                else
+                    literal += source[i++];
+            }
+            ++i;
+            if (ch == '"')
+                tokens.push_back({ Token::Type::STRING, literal });
+            else
+                tokens.push_back({ Token::Type::PUNCTUATION, "'" });
+            continue;
+        }
+
+        // Parse punctuation
+        if ((ch == '-') && ((i + 1) < source.size()) && (source[i + 1] == '>'))
+        {
+            tokens.push_back({ Token::Type::PUNCTUATION, "->" });
+            i += 2;
+            continue;
+        }
+        tokens.push_back({ Token::Type::PUNCTUATION, std::string(1, ch) });
+        ++i;
+    }
+
+    return tokens;
+}
+
+bool ParseString(const std::vector<Token>& tokens, size_t i, std::string& result)
+{
+    // Concatenate adjacent string literals
+    if ((i >= tokens.size()) || (tokens[i].type != Token::Type::STRING))
+        return false;
+
+    result.clear();
+    while ((i < tokens.size()) && (tokens[i].type == Token::Type::STRING))
+        result += tokens[i++].text;
+    return true;
+}
+
+bool IsPunctuation(const std::vector<Token>& tokens, size_t i, const char* text)
+{
+    return (i < tokens.size()) && (tokens[i].type == Token::Type::PUNCTUATION) && (tokens[i].text == text);
+}
+
+void Discover(const std::vector<Token>& tokens, std::vector<std::string>& strings)
+{
+    static const char* methods[] = { "Debug", "Info", "Warn", "Error", "Fatal" };
+
+    std::string value;
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        if (tokens[i].type != Token::Type::IDENTIFIER)
+            continue;
+
+        const std::string& name = tokens[i].text;
+
+        // Logging messages: logger.Info("message", ...) or logger->Info("message", ...)
+        if (std::find(std::begin(methods), std::end(methods), name) != std::end(methods))
+        {
+            if ((i > 0) && (IsPunctuation(tokens, i - 1, ".") || IsPunctuation(tokens, i - 1, "->")) && IsPunctuation(tokens, i + 1, "(") && ParseString(tokens, i + 2, value))
+                strings.push_back(value);
+        }
+        // Logger names: Logger logger("name"), Logger("name") or Logger logger{"name"}
+        else if (name == "Logger")
+        {
+            size_t j = i + 1;
+            if ((j < tokens.size()) && (tokens[j].type == Token::Type::IDENTIFIER))
+                ++j;
+            if ((IsPunctuation(tokens, j, "(") || IsPunctuation(tokens, j, "{")) && ParseString(tokens, j + 1, value))
+                strings.push_back(value);
+        }
+        // Logger names: Config::CreateLogger("name") or Config::ConfigLogger("name", sink)
+        else if ((name == "CreateLogger") || (name == "ConfigLogger"))
+        {
+            if (IsPunctuation(tokens, i + 1, "(") && ParseString(tokens, i + 2, value))
+                strings.push_back(value);
+        }
+    }
+}
+
+bool UpdateHashmap(Hashlog& hashmap, const std::string& message, bool hash64, bool verbose)
+{
+    uint64_t hash = hash64 ? Hash64Layout::Hash(message) : HashLayout::Hash(message);
+
+    std::string_view previous;
+    if (!hashmap.Find(hash, previous))
+    {
+        if (verbose)
+            std::cout << fmt::format("Discovered logging message: \"{}\" with hash = 0x{:08X}", message, hash) << std::endl;
+        hashmap.Insert(hash, message);
+    }
+    else if (message != previous)
+    {
+        std::cerr << fmt::format("Collision detected!") << std::endl;
+        std::cerr << fmt::format("Previous logging message: \"{}\" with hash = 0x{:08X}", previous, hash) << std::endl;
+        std::cerr << fmt::format("Conflict logging message: \"{}\" with hash = 0x{:08X}", message, hash) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version(version).usage("hashgen [options] source1 [source2 ...]");
+
+    parser.add_option("-o", "--output").dest("output").help("Output .hashlog file name (default is .hashlog)");
+    parser.add_option("-w", "--hash64").dest("hash64").action("store_true").help("Generate 64-bit hashes of Hash64Layout");
+    parser.add_option("-v", "--verbose").dest("verbose").action("store_true").help("Show discovered logging messages");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help") || parser.args().empty())
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    try
+    {
+        bool hash64 = options.is_set("hash64") && options.get("hash64");
+        bool verbose = options.is_set("verbose") && options.get("verbose");
+
+        // Default logger name and the format of logging messages without arguments
+        Hashlog hashmap;
+        UpdateHashmap(hashmap, "", hash64, verbose);
+        UpdateHashmap(hashmap, "{}", hash64, verbose);
+
+        // Discover logging messages and logger names in all source files
+        bool collision = false;
+        for (const auto& source : parser.args())
+        {
+            std::vector<std::string> strings;
+            Discover(Tokenize(ReadSource(Path(source))), strings);
+            for (const auto& string : strings)
+                collision |= !UpdateHashmap(hashmap, string, hash64, verbose);
+        }
+
+        if (collision)
+            throwex Exception("Collision detected!");
+
+        // Write .hashlog file
+        Path output(options.is_set("output") ? std::string(options.get("output")) : std::string(".hashlog"));
+        hashmap.Write(output);
+
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return -1;
+    }
+}
@@ -6,27 +6,28 @@
     \copyright MIT License
 */
 
+#include "logging/chunk_decoder.h"
+#include "logging/gzip_reader.h"
+#include "logging/hashlog.h"
+#include "logging/mapped_file.h"
 #include "logging/record.h"
-#include "logging/layouts/hash_layout.h"
+#include "logging/layouts/dictionary_layout.h"
+#include "logging/layouts/hash64_layout.h"
 #include "logging/layouts/text_layout.h"
 #include "logging/version.h"
-
-#include "../source/logging/appenders/minizip/unzip.h"
-#if defined(_WIN32) || defined(_WIN64)
-#include "../source/logging/appenders/minizip/iowin32.h"
-#endif
+#include "logging/zip_reader.h"
 
 #include "errors/fatal.h"
 #include "filesystem/file.h"
 #include "system/stream.h"
-#include "utility/countof.h"
-#include "utility/resource.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <memory>
-#include <unordered_map>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -50,171 +51,6 @@ Path FindHashlog(const Path& path)
     return Path();
 }
 
-std::unordered_map<uint32_t, std::string> ReadHashlog(const Path& path)
-{
-    std::unordered_map<uint32_t, std::string> hashmap;
-
-    File hashlog(path);
-
-    // Check if .hashlog is exists
-    if (!hashlog.IsExists())
-        return hashmap;
-
-    // Open .hashlog file
-    hashlog.Open(true, false);
-
-    // Check if .hashlog is opened
-    if (!hashlog)
-        return hashmap;
-
-    // Read the hash map size
-    uint32_t size;
-    if (hashlog.Read(&size, sizeof(uint32_t)) != sizeof(uint32_t))
-        return hashmap;
-
-    hashmap.reserve(size);
-
-    // Read the hash map content
-    while (size-- > 0)
-    {
-        uint32_t hash;
-        if (hashlog.Read(&hash, sizeof(uint32_t)) != sizeof(uint32_t))
-            return hashmap;
-        uint16_t length;
-        if (hashlog.Read(&length, sizeof(uint16_t)) != sizeof(uint16_t))
-            return hashmap;
-        std::vector<uint8_t> buffer(length);
-        if (hashlog.Read(buffer.data(), length) != length)
-            return hashmap;
-        std::string message(buffer.begin(), buffer.end());
-        hashmap[hash] = message;
-    }
-
-    // Close .hashlog file
-    hashlog.Close();
-
-    return hashmap;
-}
-
-bool WriteHashlog(const Path& path, const std::unordered_map<uint32_t, std::string>& hashmap)
-{
-    File hashlog(path);
-
-    // Open or create .hashlog file
-    hashlog.OpenOrCreate(false, true, true);
-
-    // Check if .hashlog is avaliable
-    if (!hashlog)
-        return false;
-
-    // Write the hash map size
-    uint32_t size = (uint32_t)hashmap.size();
-    if (hashlog.Write(&size, sizeof(uint32_t)) != sizeof(uint32_t))
-        return false;
-
-    // Read the hash map content
-    for (const auto& item : hashmap)
-    {
-        uint32_t hash = (uint32_t)item.first;
-        if (hashlog.Write(&hash, sizeof(uint32_t)) != sizeof(uint32_t))
-            return false;
-        uint16_t length = (uint16_t)item.second.size();
-        if (hashlog.Write(&length, sizeof(uint16_t)) != sizeof(uint16_t))
-            return false;
-        auto buffer = item.second.data();
-        if (hashlog.Write(buffer, length) != length)
-            return false;
-    }
-
-    // Close .hashlog file
-    hashlog.Close();
-
-    return true;
-}
-
-Path UnzipFile(const Path& path)
-{
-    // Open a zip archive
-    unzFile unzf;
-#if defined(_WIN32) || defined(_WIN64)
-    zlib_filefunc64_def ffunc;
-    fill_win32_filefunc64W(&ffunc);
-    unzf = unzOpen2_64(path.wstring().c_str(), &ffunc);
-#else
-    unzf = unzOpen64(path.string().c_str());
-#endif
-    if (unzf == nullptr)
-        throwex FileSystemException("Cannot open a zip archive!").Attach(path);
-
-    // Smart resource cleaner pattern
-    auto unzip = resource(unzf, [](unzFile handle) { unzClose(handle); });
-
-    File destination(path + ".tmp");
-
-    // Open the destination file for writing
-    destination.Create(false, true);
-
-    // Get info about the zip archive
-    unz_global_info global_info;
-    int result = unzGetGlobalInfo(unzf, &global_info);
-    if (result != UNZ_OK)
-        throwex FileSystemException("Cannot read a zip archive global info!").Attach(path);
-
-    // Loop to extract all files from the zip archive
-    uLong i;
-    for (i = 0; i < global_info.number_entry; ++i)
-    {
-        unz_file_info file_info;
-        char filename[1024];
-
-        // Get info about the current file in the zip archive
-        result = unzGetCurrentFileInfo(unzf, &file_info, filename, (unsigned)countof(filename), NULL, 0, NULL, 0);
-        if (result != UNZ_OK)
-            throwex FileSystemException("Cannot read a zip archive file info!").Attach(path);
-
-        // Check if this entry is a file
-        const size_t filename_length = strlen(filename);
-        if (filename[filename_length - 1] != '/')
-        {
-            // Open the current file in the zip archive
-            result = unzOpenCurrentFile(unzf);
-            if (result != UNZ_OK)
-                throwex FileSystemException("Cannot open a current file in the zip archive!").Attach(path);
-
-            // Smart resource cleaner pattern
-            auto unzip_file = resource(unzf, [](unzFile handle) { unzCloseCurrentFile(handle); });
-
-            // Read data from the current file in the zip archive
-            do
-            {
-                uint8_t buffer[16384];
-                result = unzReadCurrentFile(unzf, buffer, (unsigned)countof(buffer));
-                if (result > 0)
-                    destination.Write(buffer, (size_t)result);
-                else if (result < 0)
-                    throwex FileSystemException("Cannot read the current file from the zip archive!").Attach(path);
-            } while (result != UNZ_EOF);
-
-            // Close the current file in the zip archive
-            result = unzCloseCurrentFile(unzf);
-            if (result != UNZ_OK)
-                throwex FileSystemException("Cannot close the current file in the zip archive!").Attach(path);
-            unzip_file.release();
-        }
-    }
-
-    // Close the destination file
-    destination.Close();
-
-    // Close the zip archive
-    result = unzClose(unzf);
-    if (result != UNZ_OK)
-        throwex FileSystemException("Cannot close the zip archive!").Attach(path);
-    unzip.release();
-
-    return std::move(destination);
-}
-
 bool InputRecord(Reader& input, Record& record)
 {
     // Clear the logging record
@@ -272,28 +108,8 @@ bool InputRecord(Reader& input, Record& record)
     return true;
 }
 
-bool InputRecord(Reader& input, Record& record, const std::unordered_map<uint32_t, std::string>& hashmap)
+void DeserializeRecord(const uint8_t* buffer, size_t hash_size, const Hashlog& hashmap, Record& record)
 {
-    // Clear the logging record
-    record.Clear();
-
-    // Read the logging record size
-    uint32_t size;
-    if (input.Read(&size, sizeof(uint32_t)) != sizeof(uint32_t))
-        return false;
-
-    record.raw.resize(size);
-
-    // Read the logging record raw data
-    if (input.Read(record.raw.data(), size) != size)
-    {
-        std::cerr << "Failed to read from the input source!" << std::endl;
-        return false;
-    }
-
-    // Get the buffer start position
-    const uint8_t* buffer = record.raw.data();
-
     // Deserialize logging record
     std::memcpy(&record.timestamp, buffer, sizeof(uint64_t));
     buffer += sizeof(uint64_t);
@@ -303,35 +119,90 @@ bool InputRecord(Reader& input, Record& record, const std::unordered_map<uint32_
     buffer += sizeof(Level);
 
     // Deserialize the logger name
-    uint32_t logger_hash;
-    std::memcpy(&logger_hash, buffer, sizeof(uint32_t));
-    buffer += sizeof(uint32_t);
-    const auto& logger = hashmap.find(logger_hash);
-    record.logger.assign((logger != hashmap.end()) ? logger->second : format("0x{:X}",  logger_hash));
+    uint64_t logger_hash = 0;
+    std::memcpy(&logger_hash, buffer, hash_size);
+    buffer += hash_size;
+    std::string_view logger;
+    if (hashmap.Find(logger_hash, logger))
+        record.logger.assign(logger);
+    else
+        record.logger.assign(format("0x{:X}",  logger_hash));
 
     // Deserialize the logging message
-    uint32_t message_hash;
-    std::memcpy(&message_hash, buffer, sizeof(uint32_t));
-    buffer += sizeof(uint32_t);
-    const auto& message = hashmap.find(message_hash);
-    record.message.assign((message != hashmap.end()) ? message->second : format("0x{:X}",  message_hash));
+    uint64_t message_hash = 0;
+    std::memcpy(&message_hash, buffer, hash_size);
+    buffer += hash_size;
+    std::string_view message;
+    if (hashmap.Find(message_hash, message))
+        record.message.assign(message);
+    else
+        record.message.assign(format("0x{:X}",  message_hash));
 
     // Deserialize the logging buffer
     uint32_t buffer_size;
     std::memcpy(&buffer_size, buffer, sizeof(uint32_t));
     buffer += sizeof(uint32_t);
-    record.buffer.insert(record.buffer.begin(), buffer, buffer + buffer_size);
-    buffer += buffer_size;
+    record.buffer.assign(buffer, buffer + buffer_size);
+}
 
-    // Skip the last zero byte
-    ++buffer;
+bool InputRecord(Reader& input, Record& record, Hashlog& hashmap)
+{
+    // Clear the logging record
+    record.Clear();
+
+    // Read the logging record size
+    uint32_t size;
+    if (input.Read(&size, sizeof(uint32_t)) != sizeof(uint32_t))
+        return false;
+
+    // Read inline dictionary entries of the dictionary layout
+    while ((size & DictionaryLayout::DICTIONARY_FLAG) != 0)
+    {
+        size &= ~DictionaryLayout::DICTIONARY_FLAG;
+        if (size < sizeof(uint32_t))
+        {
+            std::cerr << "Invalid dictionary entry!" << std::endl;
+            return false;
+        }
+
+        record.raw.resize(size);
+        if (input.Read(record.raw.data(), size) != size)
+        {
+            std::cerr << "Failed to read from the input source!" << std::endl;
+            return false;
+        }
+
+        uint32_t hash;
+        std::memcpy(&hash, record.raw.data(), sizeof(uint32_t));
+        hashmap.Insert(hash, std::string_view((const char*)record.raw.data() + sizeof(uint32_t), size - sizeof(uint32_t)));
 
+        if (input.Read(&size, sizeof(uint32_t)) != sizeof(uint32_t))
+            return false;
+    }
+
+    // Check for 64-bit hashes of the 64-bit hash layout
+    size_t hash_size = sizeof(uint32_t);
+    if ((size & Hash64Layout::HASH64_FLAG) != 0)
+    {
+        size &= ~Hash64Layout::HASH64_FLAG;
+        hash_size = sizeof(uint64_t);
+    }
+
+    record.raw.resize(size);
+
+    // Read the logging record raw data
+    if (input.Read(record.raw.data(), size) != size)
+    {
+        std::cerr << "Failed to read from the input source!" << std::endl;
+        return false;
+    }
+
+    DeserializeRecord(record.raw.data(), hash_size, hashmap, record);
     return true;
 }
 
-bool OutputRecord(Writer& output, Record& record)
+bool OutputRecord(Writer& output, TextLayout& layout, Record& record)
 {
-    TextLayout layout;
     layout.LayoutRecord(record);
 
     size_t size = record.raw.size() - 1;
@@ -344,18 +215,113 @@ bool OutputRecord(Writer& output, Record& record)
     return true;
 }
 
-bool UpdateHashmap(std::unordered_map<uint32_t, std::string>& hashmap, std::string_view message, uint32_t message_hash)
+//! Input chunk of the memory-mapped file
+using Chunk = ChunkDecoder::Chunk;
+
+//! Input chunk size
+const size_t CHUNK_SIZE = ChunkDecoder::CHUNK_SIZE;
+
+std::vector<Chunk> SplitRecords(const uint8_t* data, size_t size, Hashlog& hashmap)
+{
+    std::vector<Chunk> chunks;
+
+    // Split logging records at record boundaries and collect inline dictionary entries,
+    // so chunks could be decoded in parallel with the read-only hash logs map
+    size_t start = 0;
+    size_t offset = 0;
+    while ((size - offset) >= sizeof(uint32_t))
+    {
+        uint32_t record_size;
+        std::memcpy(&record_size, data + offset, sizeof(uint32_t));
+        bool dictionary = ((record_size & DictionaryLayout::DICTIONARY_FLAG) != 0);
+        record_size &= dictionary ? ~DictionaryLayout::DICTIONARY_FLAG : ~Hash64Layout::HASH64_FLAG;
+        if ((size - offset - sizeof(uint32_t)) < record_size)
+        {
+            std::cerr << "Failed to read from the input source!" << std::endl;
+            break;
+        }
+        if (dictionary)
+        {
+            if (record_size < sizeof(uint32_t))
+            {
+                std::cerr << "Invalid dictionary entry!" << std::endl;
+                break;
+            }
+
+            uint32_t hash;
+            std::memcpy(&hash, data + offset + sizeof(uint32_t), sizeof(uint32_t));
+            hashmap.Insert(hash, std::string_view((const char*)data + offset + 2 * sizeof(uint32_t), record_size - sizeof(uint32_t)));
+        }
+        offset += sizeof(uint32_t) + record_size;
+
+        if ((offset - start) >= CHUNK_SIZE)
+        {
+            chunks.push_back({ data + start, offset - start, 0 });
+            start = offset;
+        }
+    }
+    if (offset > start)
+        chunks.push_back({ data + start, offset - start, 0 });
+
+    return chunks;
+}
+
+void DecodeChunk(const Chunk& chunk, const Hashlog& hashmap, TextLayout& layout, Record& record, std::string& text)
+{
+    size_t offset = 0;
+    while (offset < chunk.size)
+    {
+        uint32_t record_size;
+        std::memcpy(&record_size, chunk.data + offset, sizeof(uint32_t));
+        offset += sizeof(uint32_t);
+
+        // Skip inline dictionary entries collected before
+        if ((record_size & DictionaryLayout::DICTIONARY_FLAG) != 0)
+        {
+            offset += record_size & ~DictionaryLayout::DICTIONARY_FLAG;
+            continue;
+        }
+
+        // Check for 64-bit hashes of the 64-bit hash layout
+        size_t hash_size = sizeof(uint32_t);
+        if ((record_size & Hash64Layout::HASH64_FLAG) != 0)
+        {
+            record_size &= ~Hash64Layout::HASH64_FLAG;
+            hash_size = sizeof(uint64_t);
+        }
+
+        record.Clear();
+        DeserializeRecord(chunk.data + offset, hash_size, hashmap, record);
+        offset += record_size;
+
+        layout.LayoutRecord(record);
+        text.append((const char*)record.raw.data(), record.raw.size() - 1);
+    }
+}
+
+void ProcessChunks(const std::vector<Chunk>& chunks, const Hashlog& hashmap, Writer& output, size_t threads)
 {
-    if (hashmap.find(message_hash) == hashmap.end())
+    bool written = ChunkDecoder::Decode(chunks, output, threads, [&hashmap](const Chunk& chunk, TextLayout& layout, Record& record, std::string& text)
+    {
+        DecodeChunk(chunk, hashmap, layout, record, text);
+    });
+    if (!written)
+        std::cerr << "Failed to write into the output source!" << std::endl;
+}
+
+bool UpdateHashmap(Hashlog& hashmap, std::string_view message, uint64_t message_hash)
+{
+    std::string_view previous;
+    if (!hashmap.Find(message_hash, previous))
     {
         std::cout << fmt::format("Discovered logging message: \"{}\" with hash = 0x{:08X}", message, message_hash) << std::endl;
-        hashmap[message_hash] = message;
+        hashmap.Insert(message_hash, message);
         return true;
     }
-    else if (message != hashmap[message_hash])
+    else if (message != previous)
     {
         std::cerr << fmt::format("Collision detected!") << std::endl;
-        std::cerr << fmt::format("Previous logging message: \"{}\" with hash = 0x{:08X}", hashmap[message_hash], message_hash) << std::endl;
+        std::cerr << fmt::format("Previous logging message: \"{}\" with hash = 0x{:08X}", previous, message_hash) << std::endl;
         std::cerr << fmt::format("Conflict logging message: \"{}\" with hash = 0x{:08X}", message, message_hash) << std::endl;
         throwex Exception("Collision detected!");
     }
@@ -364,14 +330,14 @@ bool UpdateHashmap(std::unordered_map<uint32_t, std::string>& hashmap, std::stri
     return false;
 }
 
-bool UpdateHashmap(std::unordered_map<uint32_t, std::string>& hashmap, Record& record)
+bool UpdateHashmap(Hashlog& hashmap, Record& record, bool hash64)
 {
     bool result = false;
 
     // Check the logger name
-    result |= UpdateHashmap(hashmap, record.logger, HashLayout::Hash(record.logger));
+    result |= UpdateHashmap(hashmap, record.logger, hash64 ? Hash64Layout::Hash(record.logger) : HashLayout::Hash(record.logger));
     // Check the logging message
-    result |= UpdateHashmap(hashmap, record.message, HashLayout::Hash(record.message));
+    result |= UpdateHashmap(hashmap, record.message, hash64 ? Hash64Layout::Hash(record.message) : HashLayout::Hash(record.message));
 
     return result;
 }
@@ -384,6 +350,8 @@ int main(int argc, char** argv)
     parser.add_option("-i", "--input").dest("input").help("Input file name");
     parser.add_option("-o", "--output").dest("output").help("Output file name");
     parser.add_option("-u", "--update").dest("update").help("Update .hashlog");
+    parser.add_option("-j", "--threads").dest("threads").help("Number of threads to decode the input file (default is the number of CPU cores)");
+    parser.add_option("-w", "--hash64").dest("hash64").action("store_true").help("Update .hashlog with 64-bit hashes of Hash64Layout");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -406,20 +374,26 @@ int main(int argc, char** argv)
         }
 
         // Read .hashlog file and fill the logging messages hash map
-        std::unordered_map<uint32_t, std::string> hashmap = ReadHashlog(hashlog);
-
-        Path temp_file;
+        Hashlog hashmap;
+        hashmap.Read(hashlog);
 
         // Open the input file or stdin
+        File* input_file = nullptr;
         std::unique_ptr<Reader> input(new StdInput());
         if (options.is_set("input") || options.is_set("update"))
         {
             Path path(options.is_set("input") ? options.get("input") : options.get("update"));
             if (path.IsRegularFile() && (path.extension() == ".zip"))
-                temp_file = path = UnzipFile(path);
-            File* file = new File(path);
-            file->Open(true, false);
-            input.reset(file);
+                input.reset(new ZipReader(path));
+            else if (path.IsRegularFile() && (path.extension() == ".gz"))
+                input.reset(new GzipReader(path));
+            else
+            {
+                File* file = new File(path);
+                file->Open(true, false);
+                input.reset(file);
+                input_file = file;
+            }
         }
 
         // Open the output file or stdout
@@ -434,29 +408,37 @@ int main(int argc, char** argv)
         if (options.is_set("update"))
         {
             bool store = false;
+            bool hash64 = options.is_set("hash64") && options.get("hash64");
 
             // Update hashmap with data from all logging records
             Record record;
             while (InputRecord(*input, record))
-                store |= UpdateHashmap(hashmap, record);
+                store |= UpdateHashmap(hashmap, record, hash64);
 
-            // Store updated .hashlog
+            // Append new entries into .hashlog journal
             if (store)
-                WriteHashlog(hashlog, hashmap);
+                hashmap.Append(hashlog);
         }
         else
         {
-            // Process all logging records
-            Record record;
-            while (InputRecord(*input, record, hashmap))
-                if (!OutputRecord(*output, record))
-                    break;
+            // Decode the memory-mapped input file in parallel
+            MappedFile mapped;
+            if ((input_file != nullptr) && mapped.Map(*input_file))
+            {
+                size_t threads = options.is_set("threads") ? (size_t)std::stoul(std::string(options.get("threads"))) : (size_t)std::thread::hardware_concurrency();
+                ProcessChunks(SplitRecords(mapped.data(), mapped.size(), hashmap), hashmap, *output, std::max(threads, (size_t)1));
+            }
+            else
+            {
+                // Process all logging records
+                Record record;
+                TextLayout layout;
+                while (InputRecord(*input, record, hashmap))
+                    if (!OutputRecord(*output, layout, record))
+                        break;
+            }
         }
 
-        // Delete temporary file
-        if (temp_file)
-            Path::Remove(temp_file);
-
         return 0;
     }
     catch (const std::exception& ex)